@@ -8,8 +8,29 @@
 #include <catch/catch.hpp>
 
 #include <algorithm>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 #include "utf.hpp"
+#include "utf_cache.hpp"
+#include "utf_intern.hpp"
+#include "utf_set.hpp"
+#include "utf_sort.hpp"
+#include "utf_text.hpp"
+#include "utf_unicode.hpp"
+#ifdef __cpp_impl_coroutine
+#include "utf_coro.hpp"
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#define UTFCONV_NO_MAIN
+#include "utfconv.cpp"
+#define UTFCONV_TESTS
+#endif
 
 using namespace utf;
 using namespace utf::internal;
@@ -304,9 +325,29 @@ TEST_CASE("traits/utf8/validate", "Validate a utf-8 encoded character") {
             CHECK(!traits_t::validate(buf, buf + elems(buf)));
         }
     }
-    SECTION("overlong 3-byte sequence", "lead byte holds all zeros") {
-        unsigned char buf[] = {0xe0, 0x82, 0xac};
-        CHECK(!traits_t::validate(buf, buf + elems(buf)));
+    SECTION("overlong 3-byte sequence", "lead byte holds all zeros, first continuation starts with 100") {
+        {
+            unsigned char buf[] = {0xe0, 0x82, 0xac};
+            CHECK(!traits_t::validate(buf, buf + elems(buf)));
+        }
+        {
+            unsigned char buf[] = {0xe0, 0x80, 0x80};
+            CHECK(!traits_t::validate(buf, buf + elems(buf)));
+        }
+    }
+    SECTION("3-byte sequence with 0xe0 lead", "U+0800 to U+0FFF") {
+        {
+            unsigned char buf[] = {0xe0, 0xa0, 0x80}; // U+0800
+            CHECK(traits_t::validate(buf, buf + elems(buf)));
+        }
+        {
+            unsigned char buf[] = {0xe0, 0xa4, 0xa8}; // U+0928
+            CHECK(traits_t::validate(buf, buf + elems(buf)));
+        }
+        {
+            unsigned char buf[] = {0xe0, 0xbf, 0xbf}; // U+0FFF
+            CHECK(traits_t::validate(buf, buf + elems(buf)));
+        }
     }
     SECTION("overlong 4-byte sequence", "lead byte holds all zeros, first continuation starts with 100") {
         unsigned char buf[] = {0xf0, 0x8f, 0x92, 0xa9};
@@ -906,3 +947,1897 @@ TEST_CASE("utf/codepoint_iterator", "iterators for decoding a string on the fly"
         CHECK(it == last);
     }
 }
+
+template <typename T, size_t N>
+std::vector<codepoint_type> decode_blocks(const T* first, const T* last, size_t& calls) {
+    std::vector<codepoint_type> res;
+    codepoint_type buf[N];
+    codepoint_iterator<const T*> it(first);
+    codepoint_iterator<const T*> end(last);
+    calls = 0;
+    while (it != end) {
+        size_t n = 0;
+        it = decode_block(it, end, buf, n);
+        REQUIRE(n > 0);
+        REQUIRE(n <= N);
+        res.insert(res.end(), buf, buf + n);
+        ++calls;
+    }
+    return res;
+}
+
+TEST_CASE("utf/decode_block", "decode code points into fixed-size arrays") {
+    // long ASCII runs take the fast path, the rest is decoded one at a time
+    std::string s8 = "hello world, this is plain ascii \xc3\xb8 and \xe2\x82\xac mixed \xf0\x9f\x92\xa9 in";
+    s8 += s8;
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+    std::vector<codepoint_type> expected(sv8.begin(), sv8.end());
+
+    std::vector<char16_t> s16;
+    sv8.to<utf16>(std::back_inserter(s16));
+    std::vector<char32_t> s32;
+    sv8.to<utf32>(std::back_inserter(s32));
+
+    size_t calls = 0;
+    CHECK((decode_blocks<char, 1>(s8.data(), s8.data() + s8.size(), calls)) == expected);
+    CHECK(calls == expected.size());
+    CHECK((decode_blocks<char, 7>(s8.data(), s8.data() + s8.size(), calls)) == expected);
+    CHECK((decode_blocks<char, 64>(s8.data(), s8.data() + s8.size(), calls)) == expected);
+    CHECK(calls == (expected.size() + 63) / 64);
+    CHECK((decode_blocks<char16_t, 9>(s16.data(), s16.data() + s16.size(), calls)) == expected);
+    CHECK((decode_blocks<char16_t, 256>(s16.data(), s16.data() + s16.size(), calls)) == expected);
+    CHECK((decode_blocks<char32_t, 5>(s32.data(), s32.data() + s32.size(), calls)) == expected);
+    CHECK((decode_blocks<char32_t, 256>(s32.data(), s32.data() + s32.size(), calls)) == expected);
+
+    SECTION("iterators", "ranges that aren't pointers are decoded too") {
+        stringview<std::string::const_iterator> sv(s8.begin(), s8.end());
+        codepoint_type buf[16];
+        size_t n = 0;
+        codepoint_iterator<std::string::const_iterator> it = decode_block(sv.begin(), sv.end(), buf, n);
+        CHECK(n == 16);
+        CHECK(std::equal(buf, buf + n, expected.begin()));
+        CHECK(it.base() == s8.begin() + 16);
+    }
+    SECTION("empty", "") {
+        codepoint_type buf[4];
+        size_t n = 1;
+        codepoint_iterator<const char*> it(s8.data());
+        CHECK(decode_block(it, it, buf, n) == it);
+        CHECK(n == 0);
+    }
+}
+
+namespace {
+    struct collect {
+        std::vector<codepoint_type>* out;
+        void operator()(codepoint_type c) { out->push_back(c); }
+    };
+
+    struct sum {
+        codepoint_type total;
+        void operator()(codepoint_type c) { total += c; }
+    };
+
+    // maps 'a' to U+1F4A9 and everything else to itself
+    codepoint_type replace_a(codepoint_type c) { return c == 'a' ? 0x1f4a9 : c; }
+}
+
+TEST_CASE("utf/for_each_codepoint", "call a function for each code point") {
+    std::string s8 = "some ascii text, then \xc3\xb8, \xe2\x82\xac and \xf0\x9f\x92\xa9 until the end of the string";
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+    std::vector<codepoint_type> expected(sv8.begin(), sv8.end());
+
+    std::vector<codepoint_type> actual;
+    collect c = { &actual };
+    for_each_codepoint(sv8, c);
+    CHECK(actual == expected);
+
+    SECTION("returns the function object", "") {
+        sum s = { 0 };
+        s = for_each_codepoint(sv8, s);
+        codepoint_type total = 0;
+        for (size_t i = 0; i < expected.size(); ++i) { total += expected[i]; }
+        CHECK(s.total == total);
+    }
+    SECTION("utf16", "") {
+        std::vector<char16_t> s16;
+        sv8.to<utf16>(std::back_inserter(s16));
+        actual.clear();
+        for_each_codepoint(make_stringview(s16.begin(), s16.end()), c);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("utf/transform", "map code points while transcoding") {
+    std::string s8 = "banana \xc3\xb8";
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+
+    std::vector<char16_t> out;
+    transform<utf16>(sv8, std::back_inserter(out), replace_a);
+    const char16_t expected[] = {'b', 0xd83d, 0xdca9, 'n', 0xd83d, 0xdca9, 'n', 0xd83d, 0xdca9, ' ', 0xf8};
+    CHECK(out.size() == elems(expected));
+    CHECK(std::equal(out.begin(), out.end(), expected));
+
+    SECTION("returned iterator", "points just past the output") {
+        char buf[32];
+        CHECK(transform<utf8>(sv8, buf, replace_a) == buf + s8.size() + 3 * 3);
+    }
+}
+
+TEST_CASE("utf/any_stringview", "stringview with the encoding chosen at runtime") {
+    std::string s8 = "a \xc3\xb8 \xe2\x82\xac \xf0\x9f\x92\xa9 b";
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+    std::vector<char16_t> s16;
+    sv8.to<utf16>(std::back_inserter(s16));
+    std::vector<char32_t> s32;
+    sv8.to<utf32>(std::back_inserter(s32));
+
+    any_stringview views[] = {
+        any_stringview(s8.data(), s8.size(), utf8_encoding)
+        , any_stringview(s16.data(), s16.size(), utf16_encoding)
+        , any_stringview(stringview<const char32_t*>(s32.data(), s32.data() + s32.size()))
+    };
+    CHECK(views[2].get_encoding() == utf32_encoding);
+
+    for (size_t i = 0; i < elems(views); ++i) {
+        const any_stringview& sv = views[i];
+        CHECK(sv.validate());
+        CHECK(sv.codepoints() == s32.size());
+        CHECK(sv.codeunits<utf8>() == s8.size());
+        CHECK(sv.codeunits<utf16>() == s16.size());
+        CHECK(sv.codeunits(utf32_encoding) == s32.size());
+        CHECK(sv.bytes<utf16>() == s16.size() * 2);
+        CHECK(sv.bytes(utf32_encoding) == s32.size() * 4);
+
+        std::string out8;
+        sv.to<utf8>(std::back_inserter(out8));
+        CHECK(out8 == s8);
+
+        std::vector<char16_t> out16(sv.codeunits(utf16_encoding));
+        CHECK(sv.to(utf16_encoding, out16.data()) == s16.size());
+        CHECK(out16 == s16);
+
+        std::vector<codepoint_type> cps;
+        collect c = { &cps };
+        for_each_codepoint(sv, c);
+        CHECK(std::equal(cps.begin(), cps.end(), s32.begin()));
+
+        std::vector<char32_t> mapped;
+        transform<utf32>(sv, std::back_inserter(mapped), replace_a);
+        CHECK(mapped[0] == 0x1f4a9);
+        CHECK(std::equal(mapped.begin() + 1, mapped.end(), s32.begin() + 1));
+    }
+
+    SECTION("invalid data", "") {
+        const char bad[] = {(char)0xc3, (char)0x28};
+        CHECK(!any_stringview(bad, 2, utf8_encoding).validate());
+        CHECK(any_stringview(bad, 2, utf8_encoding).bytes() == 2);
+    }
+}
+
+TEST_CASE("utf/hash", "hash code point sequences independently of encoding") {
+    std::string s8 = "hello \xc3\xb8 \xe2\x82\xac \xf0\x9f\x92\xa9 world";
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+    std::u16string s16;
+    sv8.to<utf16>(std::back_inserter(s16));
+    std::u32string s32;
+    sv8.to<utf32>(std::back_inserter(s32));
+
+    size_t h = hash(sv8);
+    CHECK(hash(make_stringview(s16.begin(), s16.end())) == h);
+    CHECK(hash(make_stringview(s32.begin(), s32.end())) == h);
+    CHECK(hash(any_stringview(s16.data(), s16.size(), utf16_encoding)) == h);
+
+    CHECK(codepoint_hash()(s8) == h);
+    CHECK(codepoint_hash()(s16) == h);
+    CHECK(codepoint_hash()(sv8) == h);
+
+    SECTION("different strings", "") {
+        std::string other = s8;
+        other[0] = 'j';
+        CHECK(codepoint_hash()(other) != h);
+        CHECK(codepoint_hash()(std::string()) != codepoint_hash()(std::string(1, '\0')));
+        CHECK(codepoint_hash()(std::string("ab")) != codepoint_hash()(std::string("ba")));
+    }
+    SECTION("equality", "") {
+        codepoint_equal eq;
+        CHECK(eq(s8, s16));
+        CHECK(eq(s16, s32));
+        CHECK(eq(sv8, s32));
+        CHECK(eq(s32, sv8));
+        CHECK(!eq(s8, std::u16string(s16.begin(), s16.end() - 1)));
+        CHECK(!eq(std::string("abc"), std::u16string(u"abd")));
+    }
+#if __cplusplus >= 202002L
+    SECTION("heterogeneous lookup", "probe a map keyed by UTF-8 with UTF-16 keys") {
+        std::unordered_map<std::string, int, codepoint_hash, codepoint_equal> m;
+        m[s8] = 42;
+        m["other"] = 1;
+        std::unordered_map<std::string, int, codepoint_hash, codepoint_equal>::iterator it = m.find(s16);
+        REQUIRE(it != m.end());
+        CHECK(it->second == 42);
+        CHECK(m.find(std::u16string(u"missing")) == m.end());
+        CHECK(m.count(std::u32string(U"other")) == 1);
+    }
+#endif
+}
+
+namespace {
+    template <typename T>
+    stringview<const T*> view(const std::basic_string<T>& s) {
+        return stringview<const T*>(s.data(), s.data() + s.size());
+    }
+
+    int sign(int x) { return x < 0 ? -1 : (x > 0 ? 1 : 0); }
+
+    // compare a and b in every combination of encodings
+    void check_compare(const std::u32string& a, const std::u32string& b, int expected) {
+        std::string a8, b8;
+        std::u16string a16, b16;
+        view(a).to<utf8>(std::back_inserter(a8));
+        view(b).to<utf8>(std::back_inserter(b8));
+        view(a).to<utf16>(std::back_inserter(a16));
+        view(b).to<utf16>(std::back_inserter(b16));
+
+        CHECK(sign(compare(view(a8), view(b8))) == expected);
+        CHECK(sign(compare(view(a8), view(b16))) == expected);
+        CHECK(sign(compare(view(a8), view(b))) == expected);
+        CHECK(sign(compare(view(a16), view(b8))) == expected);
+        CHECK(sign(compare(view(a16), view(b16))) == expected);
+        CHECK(sign(compare(view(a16), view(b))) == expected);
+        CHECK(sign(compare(view(a), view(b8))) == expected);
+        CHECK(sign(compare(view(a), view(b16))) == expected);
+        CHECK(sign(compare(view(a), view(b))) == expected);
+        CHECK(sign(compare(make_stringview(a8.begin(), a8.end()), make_stringview(b16.begin(), b16.end()))) == expected);
+
+        CHECK(equal(view(a8), view(b8)) == (expected == 0));
+        CHECK(equal(view(a8), view(b16)) == (expected == 0));
+        CHECK(equal(view(a16), view(b16)) == (expected == 0));
+        CHECK(equal(view(a16), view(b)) == (expected == 0));
+        CHECK(equal(view(a), view(b)) == (expected == 0));
+    }
+}
+
+TEST_CASE("utf/compare", "compare strings in code point order across encodings") {
+    check_compare(U"", U"", 0);
+    check_compare(U"", U"a", -1);
+    check_compare(U"a", U"", 1);
+    check_compare(U"abc", U"abc", 0);
+    check_compare(U"abc", U"abd", -1);
+    check_compare(U"abc", U"ab", 1);
+    check_compare(U"ab\u00f8", U"ab\u20ac", -1);
+
+    SECTION("surrogates", "code points above 0xffff sort after the rest of the BMP") {
+        check_compare(U"\ufffd", U"\U0001f4a9", -1);
+        check_compare(U"x\U0001f4a9", U"x\ue000", 1);
+        check_compare(U"\ud7ff", U"\U00010000", -1);
+    }
+    SECTION("long strings", "differences beyond the first block") {
+        std::u32string a(300, U'a');
+        std::u32string b = a;
+        b[200] = 0x1f4a9;
+        a[250] = 0xf8;
+        check_compare(a, b, -1);
+        check_compare(a, a, 0);
+    }
+}
+
+namespace {
+    struct codepoint_less {
+        template <typename S>
+        bool operator()(const S& lhs, const S& rhs) const { return compare(view(lhs), view(rhs)) < 0; }
+    };
+
+    // pseudo-random strings over an alphabet with all UTF-8 and UTF-16 lengths
+    std::vector<std::u32string> random_strings(size_t n, size_t max_len) {
+        const codepoint_type alphabet[] = { 0, 'a', 'b', 0x7f, 0xf8, 0x7ff, 0x800, 0xd7ff, 0xe000, 0xfffd, 0xffff, 0x10000, 0x1f4a9, 0x10ffff };
+        std::vector<std::u32string> res(n);
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < n; ++i) {
+            seed = seed * 1103515245 + 12345;
+            size_t len = (seed >> 16) % (max_len + 1);
+            for (size_t j = 0; j < len; ++j) {
+                seed = seed * 1103515245 + 12345;
+                // mostly long shared prefixes, to exercise deep recursion
+                res[i] += (seed >> 16) % 4 == 0 ? alphabet[(seed >> 20) % elems(alphabet)] : U'a';
+            }
+        }
+        return res;
+    }
+
+    template <typename T>
+    void check_sort(const std::vector<std::u32string>& strings, unsigned threads) {
+        std::vector<std::basic_string<T> > actual;
+        for (size_t i = 0; i < strings.size(); ++i) {
+            std::basic_string<T> s;
+            view(strings[i]).template to<typename native_encoding<T>::type>(std::back_inserter(s));
+            actual.push_back(s);
+        }
+        std::vector<std::basic_string<T> > expected = actual;
+        std::stable_sort(expected.begin(), expected.end(), codepoint_less());
+
+        sort_codepoint_order(actual.begin(), actual.end(), threads);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("utf/sort_codepoint_order", "radix sort strings in code point order") {
+    std::vector<std::u32string> strings = random_strings(3000, 40);
+    check_sort<char>(strings, 1);
+    check_sort<char16_t>(strings, 1);
+    check_sort<char32_t>(strings, 1);
+
+    SECTION("surrogates", "UTF-16 is sorted in code point order, not code unit order") {
+        std::vector<std::u16string> s16;
+        s16.push_back(u"\U0001f4a9");
+        s16.push_back(u"\ufffd");
+        s16.push_back(u"\ud7ff");
+        sort_codepoint_order(s16.begin(), s16.end());
+        CHECK(s16[0] == u"\ud7ff");
+        CHECK(s16[1] == u"\ufffd");
+        CHECK(s16[2] == u"\U0001f4a9");
+    }
+    SECTION("parallel", "") {
+        std::vector<std::u32string> many = random_strings(70000, 12);
+        check_sort<char>(many, 4);
+        check_sort<char16_t>(many, 4);
+        check_sort<char32_t>(many, 4);
+    }
+    SECTION("parallel split", "UTF-32 is split where the strings differ, not on its zero high byte") {
+        std::vector<std::u32string> s32;
+        for (int i = 0; i < 1000; ++i) {
+            s32.push_back(std::u32string(1, U'a' + i % 26) + U"xyz");
+        }
+        std::vector<sort_entry<char32_t> > entries, scratch(s32.size());
+        for (size_t i = 0; i < s32.size(); ++i) {
+            sort_entry<char32_t> e = { 0, s32[i].data(), s32[i].size() * 4, i };
+            entries.push_back(e);
+        }
+        radix_sorter<char32_t> sorter(entries.data(), scratch.data());
+        size_t bounds[258];
+        size_t depth = sorter.split_distinct(0, entries.size(), bounds);
+        CHECK(depth == 3);
+        size_t tasks = 0;
+        for (size_t b = 1; b < 257; ++b) {
+            if (bounds[b + 1] != bounds[b]) { ++tasks; }
+        }
+        CHECK(tasks == 26);
+    }
+    SECTION("trivial", "") {
+        std::vector<std::string> none;
+        sort_codepoint_order(none.begin(), none.end());
+        std::vector<std::string> one(1, "a");
+        sort_codepoint_order(one.begin(), one.end());
+        CHECK(one[0] == "a");
+    }
+}
+
+namespace {
+    // std::allocator which counts allocations, and fails once count
+    // reaches limit
+    template <typename T>
+    struct counting_allocator {
+        typedef T value_type;
+        size_t* count;
+        size_t limit;
+
+        explicit counting_allocator(size_t* count, size_t limit = static_cast<size_t>(-1)) : count(count), limit(limit) {}
+        template <typename U>
+        counting_allocator(const counting_allocator<U>& other) : count(other.count), limit(other.limit) {}
+
+        T* allocate(size_t n) {
+            if (*count == limit) { throw std::bad_alloc(); }
+            ++*count;
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+        template <typename U>
+        bool operator == (const counting_allocator<U>& other) const { return count == other.count; }
+        template <typename U>
+        bool operator != (const counting_allocator<U>& other) const { return count != other.count; }
+    };
+}
+
+TEST_CASE("utf/text", "owning text with inline storage for short strings") {
+    std::string s8 = "long enough to need an allocation \xc3\xb8 \xf0\x9f\x92\xa9";
+    stringview<const char*> sv8(s8.data(), s8.data() + s8.size());
+
+    text16 t(sv8);
+    std::u16string expected;
+    sv8.to<utf16>(std::back_inserter(expected));
+    CHECK(t.size() == expected.size());
+    CHECK(std::equal(t.begin(), t.end(), expected.begin()));
+    CHECK(t.c_str()[t.size()] == 0);
+    CHECK(t.bytes() == expected.size() * 2);
+    CHECK(t.codepoints() == sv8.codepoints());
+    CHECK(t.validate());
+    CHECK(!t.is_ascii());
+
+    SECTION("conversion", "") {
+        text8 back = t.to<utf8>();
+        CHECK(std::string(back.c_str()) == s8);
+        CHECK(back.codepoints() == t.codepoints());
+        CHECK(back == text8(sv8));
+        CHECK(codepoint_equal()(back, t));
+    }
+    SECTION("copy and move", "") {
+        text16 copy(t);
+        CHECK(copy == t);
+        CHECK(copy.data() != t.data());
+        text16 moved(std::move(copy));
+        CHECK(moved == t);
+        CHECK(copy.empty());
+        copy = moved;
+        CHECK(copy == t);
+        moved = text16();
+        CHECK(moved.empty());
+        CHECK(moved.c_str()[0] == 0);
+    }
+    SECTION("short strings", "are stored inline") {
+        size_t allocations = 0;
+        typedef basic_text<utf8, counting_allocator<char> > counted8;
+        counting_allocator<char> alloc(&allocations);
+        const char small[] = "fifteen chars!!";
+        counted8 a(small, small + 15, alloc);
+        CHECK(allocations == 0);
+        counted8 b(a);
+        counted8 c(std::move(b));
+        CHECK(c == a);
+        CHECK(std::string(c.c_str()) == small);
+        CHECK(allocations == 0);
+
+        counted8 d(sv8, alloc);
+        CHECK(allocations == 1);
+        basic_text<utf32, counting_allocator<char32_t> > e = d.to<utf32>();
+        CHECK(allocations == 2);
+        CHECK(e.codepoints() == d.codepoints());
+    }
+    SECTION("unequal allocators", "") {
+        typedef basic_text<utf8, counting_allocator<char> > counted8;
+        size_t ours = 0;
+        size_t theirs = 0;
+        counted8 a(sv8, counting_allocator<char>(&ours, 1));
+        counted8 b(sv8, counting_allocator<char>(&theirs));
+        // a's allocator is out of allocations, so the copy fails and a is
+        // left as it was
+        const char* before = a.data();
+        CHECK_THROWS_AS(a = std::move(b), std::bad_alloc);
+        CHECK(a.data() == before);
+        CHECK(std::string(a.c_str()) == s8);
+
+        counting_allocator<char> alloc(&ours);
+        counted8 c(alloc);
+        c = std::move(b);
+        CHECK(std::string(c.c_str()) == s8);
+        CHECK(c.data() != b.data());
+        CHECK(ours == 2);
+    }
+    SECTION("ascii and validity", "") {
+        const char ascii[] = "plain ascii text which is long";
+        CHECK(text8(ascii, ascii + 30).is_ascii());
+        const char bad[] = {(char)0xc3, (char)0x28};
+        text8 b(bad, bad + 2);
+        CHECK(!b.validate());
+        CHECK(!b.is_ascii());
+    }
+    SECTION("ordering", "") {
+        const char16_t a[] = {0xfffd};
+        const char16_t b[] = {0xd83d, 0xdca9};
+        CHECK(text16(a, a + 1) < text16(b, b + 2));
+        CHECK(text16(a, a + 1) != text16(b, b + 2));
+    }
+}
+
+TEST_CASE("utf/compact_text", "fixed-width storage at the narrowest width that fits") {
+    SECTION("latin-1", "") {
+        std::string s8 = "caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9" "e";
+        compact_text t(view(s8));
+        CHECK(t.width() == 1);
+        CHECK(t.size() == 17);
+        CHECK(t.bytes() == 17);
+        CHECK(t[3] == 0xe9);
+        CHECK(!t.is_ascii());
+        CHECK(t.max_codepoint() == 0xfb);
+        CHECK(t.codeunits<utf8>() == s8.size());
+        CHECK(t.bytes<utf16>() == 34);
+        std::string back;
+        t.to<utf8>(std::back_inserter(back));
+        CHECK(back == s8);
+    }
+    SECTION("ascii", "") {
+        std::string s8 = "plain";
+        compact_text t(view(s8));
+        CHECK(t.width() == 1);
+        CHECK(t.is_ascii());
+    }
+    SECTION("ucs-2", "") {
+        std::u16string s16 = u"\u20ac 5 \uffff";
+        compact_text t(view(s16));
+        CHECK(t.width() == 2);
+        CHECK(t.size() == 5);
+        CHECK(t[0] == 0x20ac);
+        CHECK(t[4] == 0xffff);
+        std::string back8;
+        t.to<utf8>(std::back_inserter(back8));
+        CHECK(equal(view(back8), view(s16)));
+        std::u16string back16;
+        t.to<utf16>(std::back_inserter(back16));
+        CHECK(back16 == s16);
+    }
+    SECTION("ucs-4", "") {
+        std::string s8 = "a\xf0\x9f\x92\xa9" "b";
+        compact_text t(view(s8));
+        CHECK(t.width() == 4);
+        CHECK(t.size() == 3);
+        CHECK(t[1] == 0x1f4a9);
+        CHECK(t.codeunits<utf16>() == 4);
+
+        compact_text copy(t);
+        CHECK(copy[1] == 0x1f4a9);
+        compact_text moved(std::move(copy));
+        CHECK(moved.size() == 3);
+        CHECK(copy.empty());
+        copy = moved;
+        CHECK(copy[2] == 'b');
+        std::u16string back16;
+        copy.to<utf16>(std::back_inserter(back16));
+        CHECK(equal(view(back16), view(s8)));
+    }
+    SECTION("empty", "") {
+        compact_text t(view(std::string()));
+        CHECK(t.empty());
+        CHECK(t.codeunits<utf8>() == 0);
+    }
+}
+
+TEST_CASE("utf/shared_text", "reference counted text with cached conversions") {
+    std::string s8 = "caf\xc3\xa9 \xf0\x9f\x92\xa9";
+    SECTION("sharing", "") {
+        shared_text8 t(view(s8));
+        CHECK(t.use_count() == 1);
+        shared_text8 copy = t;
+        CHECK(t.use_count() == 2);
+        CHECK(copy.data() == t.data());
+        CHECK(copy == t);
+        shared_text8 moved(std::move(copy));
+        CHECK(copy.empty());
+        CHECK(t.use_count() == 2);
+        CHECK(std::string(t.c_str()) == s8);
+        CHECK(t.validate());
+        CHECK(!t.is_ascii());
+        CHECK(t.codepoints() == 6);
+    }
+    SECTION("alternatives", "") {
+        shared_text8 t(view(s8));
+        CHECK(t.view_as<utf8>().begin().base() == t.data());
+        stringview<const char16_t*> v16 = t.view_as<utf16>();
+        CHECK(v16.codeunits() == 7);
+        CHECK(equal(v16, view(s8)));
+        CHECK(*v16.end().base() == 0);
+        shared_text8 copy = t;
+        CHECK(copy.view_as<utf16>().begin().base() == v16.begin().base());
+        stringview<const char32_t*> v32 = copy.view_as<utf32>();
+        CHECK(v32.codeunits() == 6);
+        CHECK(equal(v32, view(s8)));
+    }
+    SECTION("empty", "") {
+        shared_text16 t;
+        CHECK(t.empty());
+        CHECK(t.c_str()[0] == 0);
+        CHECK(t.view_as<utf8>().codeunits() == 0);
+        CHECK(t.validate());
+        CHECK(t == shared_text16(view(std::string())));
+    }
+    SECTION("threads", "") {
+        std::u16string s16(1000, u'\u00e9');
+        shared_text16 t(view(s16));
+        std::vector<const char*> seen(4);
+        std::vector<std::thread> pool;
+        for (int i = 0; i < 4; ++i) {
+            shared_text16 local = t;
+            pool.push_back(std::thread([&seen, i, local]() {
+                seen[i] = local.view_as<utf8>().begin().base();
+            }));
+        }
+        for (size_t i = 0; i < pool.size(); ++i) { pool[i].join(); }
+        CHECK(t.use_count() == 1);
+        for (int i = 0; i < 4; ++i) {
+            CHECK(seen[i] == t.view_as<utf8>().begin().base());
+        }
+        CHECK(t.view_as<utf8>().codeunits() == 2000);
+    }
+}
+
+TEST_CASE("utf/to_arena", "transcode into arena memory") {
+    std::string s8 = "caf\xc3\xa9 \xf0\x9f\x92\xa9";
+    SECTION("heap blocks", "") {
+        arena a(16);
+        stringview<const char16_t*> v16 = to_arena<utf16>(view(s8), a);
+        CHECK(v16.codeunits() == 7);
+        CHECK(equal(v16, view(s8)));
+        stringview<const char32_t*> v32 = to_arena<utf32>(v16, a);
+        CHECK(v32.codeunits() == 6);
+        CHECK(equal(v32, view(s8)));
+        // earlier results stay valid as the arena grows
+        for (int i = 0; i < 100; ++i) { to_arena<utf8>(v32, a); }
+        CHECK(equal(v16, view(s8)));
+        CHECK(reinterpret_cast<uintptr_t>(v32.begin().base()) % sizeof(char32_t) == 0);
+
+        a.reset();
+        stringview<const char16_t*> again = to_arena<utf16>(view(s8), a);
+        CHECK(equal(again, view(s8)));
+    }
+    SECTION("initial buffer", "") {
+        char buf[64];
+        arena a(buf, sizeof(buf));
+        stringview<const char16_t*> v16 = to_arena<utf16>(view(s8), a);
+        const char* p = reinterpret_cast<const char*>(v16.begin().base());
+        CHECK(p >= buf);
+        CHECK(p < buf + sizeof(buf));
+        // too big for what is left of buf
+        std::u32string big(100, U'x');
+        stringview<const char*> v8 = to_arena<utf8>(view(big), a);
+        CHECK(v8.codeunits() == 100);
+        CHECK(equal(v8, view(big)));
+
+        // reset goes back to buf, then to the block that was kept
+        a.reset();
+        CHECK(to_arena<utf16>(view(s8), a).begin().base() == v16.begin().base());
+        CHECK(to_arena<utf8>(view(big), a).begin().base() == v8.begin().base());
+    }
+    SECTION("alignment past the initial buffer", "") {
+        char buf[128];
+        // 4 bytes just past a 64-byte boundary, so aligning to 64 moves past their end
+        char* first = buf + (65 - reinterpret_cast<uintptr_t>(buf) % 64) % 64;
+        arena a(first, 4);
+        char* p = static_cast<char*>(a.allocate(1, 64));
+        CHECK((p < buf || p >= buf + sizeof(buf)));
+        CHECK(reinterpret_cast<uintptr_t>(p) % 64 == 0);
+    }
+    SECTION("empty", "") {
+        arena a;
+        CHECK(to_arena<utf32>(view(std::string()), a).codeunits() == 0);
+        // nothing is allocated for empty input
+        struct counting_arena {
+            int calls;
+            void* allocate(size_t, size_t) { ++calls; return nullptr; }
+        } counter = { 0 };
+        CHECK(to_arena<utf16>(view(std::string()), counter).codeunits() == 0);
+        CHECK(counter.calls == 0);
+    }
+#ifdef __cpp_lib_memory_resource
+    SECTION("pmr", "") {
+        std::pmr::monotonic_buffer_resource res;
+        stringview<const char32_t*> v32 = to_arena<utf32>(view(s8), res);
+        CHECK(equal(v32, view(s8)));
+        std::pmr::u32string str(v32.begin().base(), v32.end().base(), &res);
+        CHECK(str.size() == 6);
+    }
+    SECTION("arena as a memory_resource", "") {
+        char buf[256];
+        arena a(buf, sizeof(buf), 64);
+        std::pmr::vector<int> v(&a);
+        for (int i = 0; i < 1000; ++i) { v.push_back(i); }
+        CHECK(v.size() == 1000);
+        CHECK(v[999] == 999);
+        std::pmr::u16string str(u"caf\u00e9", &a);
+        CHECK(equal(stringview<const char16_t*>(str.data(), str.data() + str.size()), view(s8.substr(0, 5))));
+        CHECK(a.is_equal(a));
+        CHECK(!a.is_equal(*std::pmr::new_delete_resource()));
+    }
+#endif
+}
+
+namespace {
+    struct capture16 {
+        std::u16string* out;
+        size_t operator()(stringview<const char16_t*> v) const {
+            out->assign(v.begin().base(), v.end().base());
+            CHECK(*v.end().base() == 0);
+            return v.codeunits();
+        }
+    };
+
+    struct nested16 {
+        std::u16string* outer;
+        std::u16string* inner;
+        void operator()(stringview<const char16_t*> v) const {
+            std::string big(5000, 'y');
+            capture16 c = { inner };
+            with_converted<utf16>(view(big), c);
+            outer->assign(v.begin().base(), v.end().base());
+        }
+    };
+}
+
+TEST_CASE("utf/with_converted", "transcode into scratch storage for a single call") {
+    SECTION("small", "") {
+        std::string s8 = "caf\xc3\xa9";
+        std::u16string out;
+        capture16 c = { &out };
+        CHECK(with_converted<utf16>(view(s8), c) == 4);
+        CHECK(out == u"caf\u00e9");
+    }
+    SECTION("large", "") {
+        std::string s8(3000, 'x');
+        s8 += "\xf0\x9f\x92\xa9";
+        std::u16string out;
+        capture16 c = { &out };
+        CHECK(with_converted<utf16>(view(s8), c) == 3002);
+        CHECK(equal(view(out), view(s8)));
+        // reuses the thread-local buffer
+        std::string shorter(2000, 'z');
+        CHECK(with_converted<utf16>(view(shorter), c) == 2000);
+        CHECK(out == std::u16string(2000, u'z'));
+    }
+    SECTION("nested", "") {
+        std::string s8(4000, 'x');
+        std::u16string outer, inner;
+        nested16 f = { &outer, &inner };
+        with_converted<utf16>(view(s8), f);
+        CHECK(outer == std::u16string(4000, u'x'));
+        CHECK(inner == std::u16string(5000, u'y'));
+    }
+    SECTION("empty", "") {
+        std::u16string out = u"junk";
+        capture16 c = { &out };
+        CHECK(with_converted<utf16>(view(std::string()), c) == 0);
+        CHECK(out.empty());
+    }
+}
+
+TEST_CASE("utf/transcode_cache", "cache converted strings") {
+    SECTION("hits and misses", "") {
+        transcode_cache cache(1 << 16, 4);
+        std::string s8 = "caf\xc3\xa9";
+        cached_text<utf16> a = cache.get<utf16>(view(s8));
+        CHECK(a.codeunits() == 4);
+        CHECK(equal(a.view(), view(s8)));
+        cached_text<utf16> b = cache.get<utf16>(view(std::string(s8)));
+        CHECK(a.data() == b.data());
+        // a different target encoding is a different entry
+        cached_text<utf32> c = cache.get<utf32>(view(s8));
+        CHECK(equal(c.view(), view(s8)));
+        // and so is the same text in another source encoding
+        std::u16string s16 = u"caf\u00e9";
+        cached_text<utf16> d = cache.get<utf16>(view(s16));
+        CHECK(d.data() != a.data());
+
+        cache_stats st = cache.stats();
+        CHECK(st.hits == 1);
+        CHECK(st.misses == 3);
+        CHECK(st.entries == 3);
+        CHECK(st.bytes > 0);
+    }
+    SECTION("eviction", "") {
+        transcode_cache cache(4096, 1);
+        std::vector<std::string> keys;
+        for (int i = 0; i < 200; ++i) {
+            keys.push_back(std::string(i % 20 + 1, 'a' + i % 26));
+        }
+        cached_text<utf32> first = cache.get<utf32>(view(keys[0]));
+        for (size_t i = 1; i < keys.size(); ++i) {
+            cache.get<utf32>(view(keys[i]));
+        }
+        cache_stats st = cache.stats();
+        CHECK(st.evictions > 0);
+        CHECK(st.bytes <= 4096);
+        // evicted, but still alive through the handle
+        CHECK(equal(first.view(), view(keys[0])));
+
+        cache.clear();
+        CHECK(cache.stats().entries == 0);
+        CHECK(equal(first.view(), view(keys[0])));
+    }
+    SECTION("too large", "") {
+        transcode_cache cache(256, 1);
+        std::string big(1000, 'x');
+        cached_text<utf16> t = cache.get<utf16>(view(big));
+        CHECK(t.codeunits() == 1000);
+        CHECK(cache.stats().entries == 0);
+    }
+    SECTION("threads", "") {
+        transcode_cache cache(1 << 20);
+        std::vector<std::string> keys;
+        for (int i = 0; i < 64; ++i) {
+            keys.push_back(std::string("key \xe2\x82\xac") + std::to_string(i));
+        }
+        std::atomic<int> bad(0);
+        std::vector<std::thread> pool;
+        for (int t = 0; t < 4; ++t) {
+            pool.push_back(std::thread([&]() {
+                for (int round = 0; round < 20; ++round) {
+                    for (size_t i = 0; i < keys.size(); ++i) {
+                        if (!equal(cache.get<utf16>(view(keys[i])).view(), view(keys[i]))) { ++bad; }
+                    }
+                }
+            }));
+        }
+        for (size_t t = 0; t < pool.size(); ++t) { pool[t].join(); }
+        CHECK(bad == 0);
+        cache_stats st = cache.stats();
+        CHECK(st.hits + st.misses == 4 * 20 * 64);
+        CHECK(st.entries == 64);
+    }
+}
+
+TEST_CASE("utf/intern_pool", "intern strings across encodings") {
+    intern_pool pool;
+    SECTION("dedup", "") {
+        std::string s8 = "caf\xc3\xa9";
+        std::u16string s16 = u"caf\u00e9";
+        intern_pool::id_type a = pool.intern(view(s8));
+        CHECK(a != invalid_intern_id);
+        CHECK(pool.intern(view(std::string(s8))) == a);
+        CHECK(pool.intern(view(s16)) == a);
+        CHECK(pool.intern(any_stringview(view(s16))) == a);
+        CHECK(pool.size() == 1);
+
+        intern_pool::id_type b = pool.intern(view(std::string("cafe")));
+        CHECK(b != a);
+        CHECK(pool.size() == 2);
+        CHECK(pool.find(view(std::u32string(U"cafe"))) == b);
+        CHECK(pool.find(view(std::string("tea"))) == invalid_intern_id);
+        CHECK(pool.size() == 2);
+
+        CHECK(std::string(pool.view(a).begin().base()) == s8);
+    }
+    SECTION("3-byte sequences below U+1000", "") {
+        std::string s8 = "\xe0\xa4\xa8\xe0\xa4\xae"; // U+0928 U+092E
+        intern_pool::id_type id = pool.intern(view(s8));
+        CHECK(id != invalid_intern_id);
+        CHECK(pool.intern(view(std::u16string(u"\u0928\u092e"))) == id);
+        CHECK(pool.find(view(std::u32string(U"\u0928\u092e"))) == id);
+    }
+    SECTION("invalid", "") {
+        std::string bad = "a\xff";
+        CHECK(pool.intern(view(bad)) == invalid_intern_id);
+        CHECK(pool.size() == 0);
+    }
+    SECTION("materialize", "") {
+        std::string s8 = "x\xf0\x9f\x92\xa9";
+        intern_pool::id_type id = pool.intern(view(s8));
+        stringview<const char16_t*> v16 = pool.view_as<utf16>(id);
+        CHECK(v16.codeunits() == 3);
+        CHECK(equal(v16, view(s8)));
+        CHECK(pool.view_as<utf16>(id).begin().base() == v16.begin().base());
+        CHECK(*v16.end().base() == 0);
+        stringview<const char32_t*> v32 = pool.view_as<utf32>(id);
+        CHECK(v32.codeunits() == 2);
+        CHECK(equal(v32, view(s8)));
+    }
+    SECTION("many", "") {
+        std::vector<intern_pool::id_type> ids;
+        for (int i = 0; i < 5000; ++i) {
+            ids.push_back(pool.intern(view(std::to_string(i))));
+        }
+        CHECK(pool.size() == 5000);
+        int bad = 0;
+        for (int i = 0; i < 5000; ++i) {
+            std::string s = std::to_string(i);
+            if (pool.intern(view(s)) != ids[i] || !equal(pool.view(ids[i]), view(s))) { ++bad; }
+        }
+        CHECK(bad == 0);
+    }
+    SECTION("threads", "") {
+        std::vector<std::vector<intern_pool::id_type> > ids(4);
+        std::vector<std::thread> pool_threads;
+        for (int t = 0; t < 4; ++t) {
+            pool_threads.push_back(std::thread([&, t]() {
+                for (int i = 0; i < 1000; ++i) {
+                    std::u16string s = u"sym";
+                    std::string n = std::to_string(i);
+                    s.append(n.begin(), n.end());
+                    intern_pool::id_type id = pool.intern(view(s));
+                    ids[t].push_back(id);
+                    pool.view_as<utf32>(id);
+                }
+            }));
+        }
+        for (size_t t = 0; t < pool_threads.size(); ++t) { pool_threads[t].join(); }
+        CHECK(pool.size() == 1000);
+        for (int t = 1; t < 4; ++t) {
+            CHECK(ids[t] == ids[0]);
+        }
+    }
+}
+
+TEST_CASE("utf/ucd", "Unicode character properties") {
+    SECTION("general category", "") {
+        CHECK(get_general_category('A') == gc_lu);
+        CHECK(get_general_category('a') == gc_ll);
+        CHECK(get_general_category('7') == gc_nd);
+        CHECK(get_general_category(' ') == gc_zs);
+        CHECK(get_general_category(0x0301) == gc_mn);
+        CHECK(get_general_category(0x4e00) == gc_lo);
+        CHECK(get_general_category(0x20ac) == gc_sc);
+        CHECK(get_general_category(0xe000) == gc_co);
+        CHECK(get_general_category(0x0378) == gc_cn);
+        CHECK(get_general_category(0x110000) == gc_cn);
+    }
+    SECTION("script", "") {
+        CHECK(get_script('a') == sc_latin);
+        CHECK(get_script(0x03b1) == sc_greek);
+        CHECK(get_script(0x0430) == sc_cyrillic);
+        CHECK(get_script(0x05d0) == sc_hebrew);
+        CHECK(get_script(0x0915) == sc_devanagari);
+        CHECK(get_script(0x4e00) == sc_han);
+        CHECK(get_script(0x3042) == sc_hiragana);
+        CHECK(get_script(0xac00) == sc_hangul);
+        CHECK(get_script(0x0301) == sc_inherited);
+        CHECK(get_script('1') == sc_common);
+        CHECK(get_script(0x0378) == sc_unknown);
+        // shared between scripts, or combining with any of them
+        CHECK(get_script(0x0640) == sc_common);
+        CHECK(get_script(0x0e3f) == sc_common);
+        CHECK(get_script(0x30fc) == sc_common);
+        CHECK(get_script(0x064b) == sc_inherited);
+        CHECK(get_script(0x0951) == sc_inherited);
+        CHECK(get_script(0x1cd0) == sc_inherited);
+        CHECK(get_script(0x3005) == sc_han);
+    }
+    SECTION("east asian width", "") {
+        CHECK(get_east_asian_width('a') == eaw_narrow);
+        CHECK(get_east_asian_width(0x4e00) == eaw_wide);
+        CHECK(get_east_asian_width(0xff21) == eaw_fullwidth);
+        CHECK(get_east_asian_width(0xff71) == eaw_halfwidth);
+        CHECK(get_east_asian_width(0x03b1) == eaw_ambiguous);
+        CHECK(get_east_asian_width(0x05d0) == eaw_neutral);
+        // unassigned, but in a CJK block
+        CHECK(get_east_asian_width(0x2fff0) == eaw_wide);
+    }
+    SECTION("binary properties", "") {
+        CHECK(has_property(' ', prop_white_space));
+        CHECK(has_property(0x3000, prop_white_space));
+        CHECK(!has_property('a', prop_white_space));
+        CHECK(has_property('A', prop_uppercase));
+        CHECK(has_property(0x00aa, prop_lowercase));
+        CHECK(has_property('a', prop_xid_start));
+        CHECK(!has_property('_', prop_xid_start));
+        CHECK(has_property('_', prop_xid_continue));
+        CHECK(has_property('1', prop_xid_continue));
+        CHECK(has_property(0x200b, prop_default_ignorable));
+        CHECK(has_property(0xfe0f, prop_default_ignorable));
+        CHECK(!has_property(0x0600, prop_default_ignorable));
+        // prepended concatenation marks are format characters, but not ignorable
+        CHECK(!has_property(0x08e2, prop_default_ignorable));
+        CHECK(!has_property(0x110bd, prop_default_ignorable));
+        CHECK(!has_property(0x110cd, prop_default_ignorable));
+        CHECK(!has_property(0x13430, prop_default_ignorable));
+        CHECK(has_property(0x1f600, prop_extended_pictographic));
+        static_assert(get_general_category('x') == gc_ll, "lookups are constexpr");
+    }
+}
+
+namespace {
+    // the grapheme clusters of s, in code points
+    std::vector<std::u32string> graphemes(const std::u32string& s) {
+        std::vector<std::u32string> res;
+        stringview<const char32_t*> sv = view(s);
+        for (grapheme_iterator<const char32_t*> it = grapheme_begin(sv); it != grapheme_end(sv); ++it) {
+            res.push_back(std::u32string((*it).begin().base(), (*it).end().base()));
+        }
+        return res;
+    }
+}
+
+TEST_CASE("utf/grapheme_iterator", "extended grapheme clusters") {
+    SECTION("ascii", "") {
+        CHECK(graphemes(U"ab").size() == 2);
+        CHECK(graphemes(U"a\r\nb\n\r") == std::vector<std::u32string>({ U"a", U"\r\n", U"b", U"\n", U"\r" }));
+        CHECK(graphemes(U"").empty());
+    }
+    SECTION("combining", "") {
+        CHECK(graphemes(U"e\u0301\u0302x") == std::vector<std::u32string>({ U"e\u0301\u0302", U"x" }));
+        // a mark after a control character stands alone
+        CHECK(graphemes(U"\n\u0301").size() == 2);
+        // Devanagari: virama extends, vowel sign is a spacing mark
+        CHECK(graphemes(U"\u0915\u094d\u0937\u093f") == std::vector<std::u32string>({ U"\u0915\u094d", U"\u0937\u093f" }));
+        // prepend
+        CHECK(graphemes(U"\u0600\u0661").size() == 1);
+    }
+    SECTION("hangul", "") {
+        // L V T jamo, then a precomposed LV syllable followed by T
+        CHECK(graphemes(U"\u1100\u1161\u11a8\uac00\u11a8\uac01") == std::vector<std::u32string>({ U"\u1100\u1161\u11a8", U"\uac00\u11a8", U"\uac01" }));
+    }
+    SECTION("emoji", "") {
+        // family: man ZWJ woman ZWJ girl
+        std::u32string family = U"\U0001f468\u200d\U0001f469\u200d\U0001f467";
+        CHECK(graphemes(family + U"x") == std::vector<std::u32string>({ family, U"x" }));
+        // skin tone modifier
+        CHECK(graphemes(U"\U0001f44d\U0001f3fd").size() == 1);
+        // ZWJ after a non-pictographic character doesn't join
+        CHECK(graphemes(U"a\u200d\U0001f469").size() == 2);
+    }
+    SECTION("flags", "") {
+        std::u32string de = U"\U0001f1e9\U0001f1ea";
+        std::u32string fr = U"\U0001f1eb\U0001f1f7";
+        CHECK(graphemes(de + fr + U"\U0001f1e6") == std::vector<std::u32string>({ de, fr, U"\U0001f1e6" }));
+    }
+    SECTION("utf8", "") {
+        std::string s8 = "e\xcc\x81" "a\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa";
+        stringview<const char*> sv = view(s8);
+        std::vector<std::string> res;
+        for (grapheme_iterator<const char*> it(sv); it != grapheme_end(sv); ++it) {
+            res.push_back(std::string((*it).begin().base(), (*it).end().base()));
+        }
+        CHECK(res == std::vector<std::string>({ "e\xcc\x81", "a", "\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa" }));
+    }
+    SECTION("properties", "") {
+        CHECK(get_grapheme_break('a') == gcb_other);
+        CHECK(get_grapheme_break(0x0301) == gcb_extend);
+        CHECK(get_grapheme_break(0xac00) == gcb_lv);
+        CHECK(get_grapheme_break(0xac01) == gcb_lvt);
+        CHECK(get_grapheme_break(0x1f600) == gcb_extended_pictographic);
+        CHECK(get_grapheme_break(0x110000) == gcb_other);
+        static_assert(get_grapheme_break(0x200d) == gcb_zwj, "lookups are constexpr");
+    }
+}
+
+TEST_CASE("utf/display_width", "terminal column widths") {
+    SECTION("ascii", "") {
+        std::string s = "hello, world, this is plain text";
+        CHECK(display_width(view(s)) == s.size());
+        CHECK(display_width(view(std::string("tab\there\n"))) == 7);
+        CHECK(display_width(view(std::string())) == 0);
+    }
+    SECTION("mixed", "") {
+        // e + combining acute, two CJK ideographs, fullwidth A, zero width space
+        std::u32string s = U"e\u0301\u4e2d\u6587\uff21\u200b!";
+        CHECK(display_width(view(s)) == 8);
+        std::string s8;
+        view(s).to<utf8>(std::back_inserter(s8));
+        CHECK(display_width(view(s8)) == 8);
+        CHECK(get_display_width(0x1100) == 2);
+        CHECK(get_display_width(0x1160) == 0);
+        CHECK(get_display_width(0x1f600) == 2);
+    }
+    SECTION("truncate", "") {
+        std::string s8 = "abcdefghij\xe4\xb8\xad\xe6\x96\x87xyz";
+        stringview<const char*> sv = view(s8);
+        CHECK(truncate_to_width(sv, 0).base() == s8.data());
+        CHECK(truncate_to_width(sv, 10).base() == s8.data() + 10);
+        // the second ideograph doesn't fit in 13 columns
+        CHECK(truncate_to_width(sv, 13).base() == s8.data() + 13);
+        CHECK(truncate_to_width(sv, 14).base() == s8.data() + 16);
+        CHECK(truncate_to_width(sv, 100).base() == s8.data() + s8.size());
+        // combining marks stay with the character before them
+        std::u16string s16 = u"ab\u0301c";
+        CHECK(truncate_to_width(view(s16), 2).base() == s16.data() + 3);
+    }
+    SECTION("encoding", "") {
+        // UTF-8 stored in 16-bit units is measured as UTF-8, not UTF-16
+        const uint16_t units[] = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 0xe4, 0xb8, 0xad, 'z' };
+        stringview<const uint16_t*, utf8> sv(units, units + elems(units));
+        CHECK(display_width(sv) == 12);
+        CHECK(truncate_to_width(sv, 10).base() == units + 9);
+        CHECK(truncate_to_width(sv, 11).base() == units + 12);
+    }
+}
+
+TEST_CASE("utf/truncate_bytes", "truncate to a byte limit on a code point boundary") {
+    SECTION("utf8", "") {
+        // a, e-acute (2 bytes), euro sign (3 bytes), pile of poo (4 bytes)
+        std::string s8 = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x92\xa9";
+        stringview<const char*> sv = view(s8);
+        const size_t expected[] = { 0, 1, 1, 3, 3, 3, 6, 6, 6, 6, 10, 10 };
+        for (size_t n = 0; n < elems(expected); ++n) {
+            stringview<const char*> t = truncate_bytes(sv, n);
+            CHECK(t.codeunits() == expected[n]);
+            CHECK(t.validate());
+        }
+    }
+    SECTION("utf16", "") {
+        std::u16string s16 = u"a\U0001f4a9b";
+        stringview<const char16_t*> sv = view(s16);
+        CHECK(truncate_bytes(sv, 1).codeunits() == 0);
+        CHECK(truncate_bytes(sv, 2).codeunits() == 1);
+        CHECK(truncate_bytes(sv, 4).codeunits() == 1);
+        CHECK(truncate_bytes(sv, 6).codeunits() == 3);
+        CHECK(truncate_bytes(sv, 8).codeunits() == 4);
+    }
+    SECTION("utf32", "") {
+        std::u32string s32 = U"abc";
+        CHECK(truncate_bytes(view(s32), 11).codeunits() == 2);
+    }
+    SECTION("grapheme", "") {
+        // e + combining acute is 3 bytes, and can't be split
+        std::string s8 = "xe\xcc\x81y";
+        stringview<const char*> sv = view(s8);
+        CHECK(truncate_bytes(sv, 3).codeunits() == 2);
+        CHECK(truncate_bytes_at_grapheme(sv, 3).codeunits() == 1);
+        CHECK(truncate_bytes_at_grapheme(sv, 4).codeunits() == 4);
+        CHECK(truncate_bytes_at_grapheme(sv, 10).codeunits() == 5);
+        CHECK(truncate_bytes_at_grapheme(sv, 0).codeunits() == 0);
+    }
+}
+
+TEST_CASE("utf/find", "search without decoding") {
+    SECTION("codepoint", "") {
+        std::string s8 = "na\xc3\xafve caf\xc3\xa9 \xf0\x9f\x92\xa9!";
+        stringview<const char*> sv = view(s8);
+        CHECK(find(sv, 'a').base() == s8.data() + 1);
+        CHECK(find(sv, 0xe9).base() == s8.data() + 10);
+        CHECK(find(sv, 0x1f4a9).base() == s8.data() + 13);
+        CHECK(find(sv, '!').base() == s8.data() + 17);
+        CHECK(find(sv, 'z') == sv.end());
+        // a continuation byte of the needle never matches mid-sequence
+        CHECK(find(sv, 0xa9) == sv.end());
+        stringview<std::string::const_iterator> it_sv(s8.begin(), s8.end());
+        CHECK(find(it_sv, 0xe9).base() == s8.begin() + 10);
+        CHECK(find(it_sv, view(std::u16string(u"\U0001f4a9!"))).base() == s8.begin() + 13);
+
+        std::u16string s16 = u"x\U0001f4a9y\u00e9";
+        CHECK(find(view(s16), 0x1f4a9).base() == s16.data() + 1);
+        CHECK(find(view(s16), 0xe9).base() == s16.data() + 4);
+        CHECK(find(view(s16), 0xdca9) == view(s16).end());
+        std::u32string s32 = U"abc";
+        CHECK(find(view(s32), 'c').base() == s32.data() + 2);
+        // not code points, so never found
+        CHECK(find(sv, 0xd800) == sv.end());
+        CHECK(find(sv, 0x110000) == sv.end());
+        CHECK(find(view(s16), 0xd83d) == view(s16).end());
+        CHECK(find(view(s16), 0x110000) == view(s16).end());
+        CHECK(find(view(s32), 0x110000) == view(s32).end());
+    }
+    SECTION("substring", "") {
+        std::string s8 = "one caf\xc3\xa9, two caf\xc3\xa9s";
+        stringview<const char*> sv = view(s8);
+        CHECK(find(sv, view(std::string("caf\xc3\xa9s"))).base() == s8.data() + 15);
+        // the needle is transcoded to the haystack's encoding
+        CHECK(find(sv, view(std::u16string(u"two"))).base() == s8.data() + 11);
+        CHECK(find(sv, view(std::u32string(U"caf\u00e9,"))).base() == s8.data() + 4);
+        CHECK(find(sv, view(std::string("tea"))) == sv.end());
+        CHECK(find(sv, view(std::string())) == sv.begin());
+        std::string empty;
+        CHECK(find(view(empty), view(std::string("a"))) == view(empty).end());
+        std::u16string s16 = u"ab\U0001f4a9\U0001f4a9c";
+        CHECK(find(view(s16), view(std::string("\xf0\x9f\x92\xa9" "c"))).base() == s16.data() + 4);
+    }
+    SECTION("long needle", "") {
+        std::string needle(100, 'x');
+        needle += "\xc3\xa9";
+        std::string s8 = std::string(150, 'x') + "y" + needle + "z";
+        std::u32string needle32;
+        view(needle).to<utf32>(std::back_inserter(needle32));
+        CHECK(find(view(s8), view(needle32)).base() == s8.data() + 151);
+        needle32 += U'q';
+        CHECK(find(view(s8), view(needle32)) == view(s8).end());
+    }
+    SECTION("invalid needle", "") {
+        // needles holding values which aren't code points are never found
+        std::string s8 = "ab\xed\xa0\x80" "c";
+        std::u16string s16 = u"abc";
+        std::u32string surrogate = U"\xd800";
+        std::u32string too_large = U"\x110000";
+        std::u32string mid = U"b\xd800";
+        CHECK(find(view(s8), view(surrogate)) == view(s8).end());
+        CHECK(find(view(s8), view(too_large)) == view(s8).end());
+        CHECK(find(view(s8), view(mid)) == view(s8).end());
+        CHECK(find(view(s16), view(surrogate)) == view(s16).end());
+        CHECK(find(view(s16), view(too_large)) == view(s16).end());
+        CHECK(find(view(s16), view(std::u32string(U"b\x110000"))) == view(s16).end());
+        // also past the part which is encoded up front
+        std::u32string long_needle = std::u32string(100, U'x') + U"\x110000";
+        std::string hay8 = std::string(150, 'x');
+        std::u16string hay16(150, u'x');
+        CHECK(find(view(hay8), view(long_needle)) == view(hay8).end());
+        CHECK(find(view(hay16), view(long_needle)) == view(hay16).end());
+        long_needle[100] = 0xd800;
+        CHECK(find(view(hay8), view(long_needle)) == view(hay8).end());
+        CHECK(find(view(hay16), view(long_needle)) == view(hay16).end());
+    }
+}
+
+namespace {
+    // the pieces of a split range, converted to UTF-8
+    template <typename Range>
+    std::vector<std::string> pieces(const Range& r) {
+        std::vector<std::string> res;
+        for (typename Range::iterator it = r.begin(); it != r.end(); ++it) {
+            std::string s;
+            (*it).template to<utf8>(std::back_inserter(s));
+            res.push_back(s);
+        }
+        return res;
+    }
+}
+
+TEST_CASE("utf/split", "split on delimiter code points") {
+    typedef std::vector<std::string> strings;
+    SECTION("codepoint", "") {
+        std::string s8 = "a,b\xc3\xa9,,c,";
+        strings expected = { "a", "b\xc3\xa9", "", "c", "" };
+        CHECK(pieces(split(view(s8), ',')) == expected);
+        CHECK(pieces(split(view(std::string()), ',')) == strings(1));
+        CHECK(pieces(split(view(std::string("abc")), ',')) == strings(1, "abc"));
+        // pieces point into the original string
+        CHECK((*split(view(s8), ',').begin()).begin().base() == s8.data());
+
+        std::string tsv = "x\xe2\x86\x92y\xe2\x86\x92\xf0\x9f\x92\xa9";
+        strings arrows = { "x", "y", "\xf0\x9f\x92\xa9" };
+        CHECK(pieces(split(view(tsv), 0x2192)) == arrows);
+        std::u16string s16 = u"x\u2192y\u2192\U0001f4a9";
+        CHECK(pieces(split(view(s16), 0x2192)) == arrows);
+        stringview<std::string::const_iterator> it_sv(tsv.begin(), tsv.end());
+        CHECK(pieces(split(it_sv, 0x2192)) == arrows);
+
+        // invalid delimiters are never found
+        CHECK(pieces(split(view(s8), 0xd800)) == strings(1, s8));
+        CHECK(pieces(split(view(s8), 0x110000)) == strings(1, s8));
+    }
+    SECTION("any", "") {
+        std::string s8 = "a b\tc\xc2\xa0" "d  e";
+        strings expected = { "a", "b", "c", "d", "", "e" };
+        CHECK(pieces(split_any(view(s8), view(std::u32string(U" \t\u00a0")))) == expected);
+        strings ascii_only = { "a", "b", "c\xc2\xa0" "d", "", "e" };
+        CHECK(pieces(split_any(view(s8), view(std::string(" \t")))) == ascii_only);
+        std::u16string s16 = u"1\u00a02;3";
+        strings numbers = { "1", "2", "3" };
+        CHECK(pieces(split_any(view(s16), view(std::string(";\xc2\xa0")))) == numbers);
+        CHECK(pieces(split_any(view(s8), view(std::string()))) == strings(1, s8));
+
+        // delimiters out of order, and more than fit in the sorted array
+        std::u32string greek = U"\u03c9\u03b1\u03bc";
+        std::u32string many;
+        for (codepoint_type c = 0x3b1; c <= 0x3d1; ++c) { many += c; }
+        std::string s8b = "x\xce\xb1y\xce\xbcz\xcf\x89w";
+        strings letters = { "x", "y", "z", "w" };
+        CHECK(pieces(split_any(view(s8b), view(greek))) == letters);
+        CHECK(pieces(split_any(view(s8b), view(many))) == letters);
+        CHECK(pieces(split_any(view(s8b), view(std::u32string(U"\u03b2")))) == strings(1, s8b));
+    }
+}
+
+TEST_CASE("utf/codepoint_set", "sets of code points") {
+    SECTION("membership", "") {
+        codepoint_set digits('0', '9');
+        CHECK(digits.contains('0'));
+        CHECK(digits.contains('9'));
+        CHECK_FALSE(digits.contains('a'));
+        CHECK(digits.size() == 10);
+
+        codepoint_set s(view(std::u32string(U"ba\u00e9\U0001f4a9ac")));
+        CHECK(s.size() == 5);
+        CHECK(s.contains('c'));
+        CHECK(s.contains(0xe9));
+        CHECK(s.contains(0x1f4a9));
+        CHECK_FALSE(s.contains('d'));
+        CHECK_FALSE(s.contains(0xea));
+        std::vector<codepoint_type> boundaries = { 'a', 'd', 0xe9, 0xea, 0x1f4a9, 0x1f4aa };
+        CHECK(s.boundaries() == boundaries);
+
+        CHECK(codepoint_set().empty());
+        CHECK(codepoint_set(0, 0x200000).size() == 0x110000);
+        CHECK(codepoint_set('b', 'a').empty());
+    }
+    SECTION("algebra", "") {
+        codepoint_set lower('a', 'z');
+        codepoint_set vowels(view(std::string("aeiou")));
+        CHECK((lower & vowels) == vowels);
+        CHECK((lower | vowels) == lower);
+        codepoint_set consonants = lower - vowels;
+        CHECK(consonants.size() == 21);
+        CHECK_FALSE(consonants.contains('e'));
+        CHECK(consonants.contains('f'));
+        CHECK((consonants ^ lower) == vowels);
+
+        codepoint_set not_lower = ~lower;
+        CHECK(not_lower.size() == 0x110000 - 26);
+        CHECK(not_lower.contains(0));
+        CHECK(not_lower.contains(0x10ffff));
+        CHECK_FALSE(not_lower.contains('q'));
+        CHECK(~not_lower == lower);
+        CHECK((~codepoint_set()).size() == 0x110000);
+
+        codepoint_set s;
+        s.insert('x').insert(0x4e00, 0x9fff).insert('y');
+        CHECK(s.size() == 0x5202);
+        s.erase(0x5000, 0x9fff);
+        CHECK(s.contains(0x4fff));
+        CHECK_FALSE(s.contains(0x5000));
+        CHECK(s.boundaries().size() == 4);
+    }
+    SECTION("bulk", "") {
+        codepoint_set punct(view(std::u32string(U".,!\u3002")));
+        std::string s8 = "Hi, caf\xc3\xa9. \xe4\xbd\xa0\xe5\xa5\xbd\xe3\x80\x82";
+        CHECK(find(view(s8), punct).begin().base() == s8.data() + 2);
+        CHECK(count(view(s8), punct) == 3);
+        std::string stripped;
+        strip(view(s8), punct, std::back_inserter(stripped));
+        CHECK(stripped == "Hi caf\xc3\xa9 \xe4\xbd\xa0\xe5\xa5\xbd");
+
+        std::u16string s16 = u"Hi, caf\u00e9. \u4f60\u597d\u3002";
+        CHECK(find(view(s16), punct).begin().base() == s16.data() + 2);
+        CHECK(count(view(s16), punct) == 3);
+        std::u16string stripped16;
+        strip(view(s16), punct, std::back_inserter(stripped16));
+        CHECK(stripped16 == u"Hi caf\u00e9 \u4f60\u597d");
+
+        // no ASCII members: long ASCII runs are skipped in blocks
+        codepoint_set cjk(0x4e00, 0x9fff);
+        std::string ascii(100, 'a');
+        std::string mixed = ascii + "\xe4\xbd\xa0" + ascii + "\xc3\xa9";
+        CHECK(find(view(ascii), cjk).codeunits() == 0);
+        CHECK(find(view(ascii), cjk).begin() == view(ascii).end());
+        CHECK(find(view(mixed), cjk).begin().base() == mixed.data() + 100);
+        CHECK(count(view(mixed), cjk) == 1);
+        stringview<std::string::const_iterator> it_sv(mixed.begin(), mixed.end());
+        CHECK(count(it_sv, cjk) == 1);
+
+        std::vector<std::string> fields = { "a", "b", "c" };
+        CHECK(pieces(split_any(view(std::string("a.b\xe3\x80\x82" "c")), punct)) == fields);
+
+        // UTF-8 held in wider code units: the result is searched and viewed as UTF-8
+        std::vector<uint16_t> wide(s8.begin(), s8.end());
+        for (size_t i = 0; i < wide.size(); ++i) { wide[i] &= 0xff; }
+        stringview<const uint16_t*, utf8> wide_sv(wide.data(), wide.data() + wide.size());
+        stringview<const uint16_t*, utf8> found = find(wide_sv, punct);
+        CHECK(found.begin().base() == wide.data() + 2);
+        CHECK(found.codeunits() == wide.size() - 2);
+        CHECK(found.validate());
+    }
+    SECTION("long input", "matches at every offset of the 8-byte ASCII blocks") {
+        // no ASCII members, so UTF-8 takes the block path; members of 2, 3
+        // and 4 bytes also straddle the block boundaries
+        codepoint_set set(view(std::u32string(U"\u00e9\u4e2d\U0001f4a9")));
+        const codepoint_type members[] = { 0xe9, 0x4e2d, 0x1f4a9 };
+        for (size_t m = 0; m < elems(members); ++m) {
+            for (size_t k = 0; k < 72; ++k) {
+                std::u32string s32 = std::u32string(k, U'x') + members[m] + std::u32string(80, U'x');
+                std::string s8;
+                view(s32).to<utf8>(std::back_inserter(s8));
+                std::u16string s16;
+                view(s32).to<utf16>(std::back_inserter(s16));
+                CHECK(find(view(s8), set).begin().base() == s8.data() + k);
+                CHECK(find(view(s16), set).begin().base() == s16.data() + k);
+                CHECK(count(view(s8), set) == 1);
+                CHECK(count(view(s16), set) == 1);
+                std::string stripped;
+                strip(view(s8), set, std::back_inserter(stripped));
+                CHECK(stripped == std::string(k + 80, 'x'));
+                std::u16string stripped16;
+                strip(view(s16), set, std::back_inserter(stripped16));
+                CHECK(stripped16 == std::u16string(k + 80, u'x'));
+                std::vector<std::string> fields = { std::string(k, 'x'), std::string(80, 'x') };
+                CHECK(pieces(split_any(view(s8), set)) == fields);
+                CHECK(pieces(split_any(view(s16), set)) == fields);
+            }
+        }
+        // after each match the scan restarts at a different offset
+        std::u32string s32;
+        for (size_t k = 0; k < 24; ++k) { s32 += std::u32string(k, U'x') + members[k % 3]; }
+        std::string s8;
+        view(s32).to<utf8>(std::back_inserter(s8));
+        std::u16string s16;
+        view(s32).to<utf16>(std::back_inserter(s16));
+        CHECK(count(view(s8), set) == 24);
+        CHECK(count(view(s16), set) == 24);
+        CHECK(pieces(split_any(view(s8), set)).size() == 25);
+        std::string stripped;
+        strip(view(s8), set, std::back_inserter(stripped));
+        CHECK(stripped == std::string(23 * 24 / 2, 'x'));
+        // with an ASCII member, the block path is not taken
+        codepoint_set with_comma = set | codepoint_set(',', ',');
+        std::string commas = std::string(70, 'x') + "," + std::string(10, 'x');
+        CHECK(find(view(commas), with_comma).begin().base() == commas.data() + 70);
+        CHECK(find(view(commas), set).begin() == view(commas).end());
+    }
+}
+
+TEST_CASE("utf/scan_identifier", "UAX #31 identifiers") {
+    SECTION("ascii", "") {
+        std::string s = "foo_Bar9 = 1";
+        CHECK(scan_identifier(view(s)).base() == s.data() + 8);
+        std::string under = "_x-y";
+        CHECK(scan_identifier(view(under)).base() == under.data() + 2);
+        std::string digit = "9lives";
+        CHECK(scan_identifier(view(digit)) == view(digit).begin());
+        std::string empty;
+        CHECK(scan_identifier(view(empty)) == view(empty).begin());
+        std::string all = "identifier";
+        CHECK(scan_identifier(view(all)) == view(all).end());
+    }
+    SECTION("unicode", "") {
+        std::string s = "caf\xc3\xa9_na\xc3\xafve(";
+        CHECK(scan_identifier(view(s)).base() == s.data() + 12);
+        // a combining mark continues an identifier, but cannot start one
+        std::string mark = "e\xcc\x81t\xc3\xa9 ";
+        CHECK(scan_identifier(view(mark)).base() == mark.data() + 6);
+        std::string lead_mark = "\xcc\x81" "e";
+        CHECK(scan_identifier(view(lead_mark)) == view(lead_mark).begin());
+        std::string cjk = "\xe5\x8f\x98\xe9\x87\x8f" "1+";
+        CHECK(scan_identifier(view(cjk)).base() == cjk.data() + 7);
+        // emoji and non-breaking spaces end an identifier
+        std::string emoji = "x\xf0\x9f\x92\xa9";
+        CHECK(scan_identifier(view(emoji)).base() == emoji.data() + 1);
+        std::string nbsp = "ab\xc2\xa0" "c";
+        CHECK(scan_identifier(view(nbsp)).base() == nbsp.data() + 2);
+
+        std::u16string s16 = u"\u03b1\u03b2\U0001d400_1 x";
+        CHECK(scan_identifier(view(s16)).base() == s16.data() + 6);
+        stringview<std::string::const_iterator> it_sv(s.begin(), s.end());
+        CHECK(scan_identifier(it_sv).base() == s.begin() + 12);
+    }
+    SECTION("long input", "identifiers ending at every offset of an 8-byte block") {
+        // the end is an ASCII, 2-byte or 3-byte code point, after ASCII or
+        // non-ASCII identifier characters
+        const std::u32string ends[] = { U" ", U"\u00a0", U"\u3002" };
+        const std::u32string parts[] = { U"a", U"\u00e9", U"\u4e2d" };
+        for (size_t e = 0; e < elems(ends); ++e) {
+            for (size_t p = 0; p < elems(parts); ++p) {
+                for (size_t k = 64; k < 72; ++k) {
+                    std::u32string id32 = U"_";
+                    for (size_t i = 1; i < k; ++i) { id32 += i % 5 == 0 ? parts[p] : U"b"; }
+                    std::string id8;
+                    view(id32).to<utf8>(std::back_inserter(id8));
+                    std::u16string id16;
+                    view(id32).to<utf16>(std::back_inserter(id16));
+                    std::string s8;
+                    view(id32 + ends[e] + U"tail").to<utf8>(std::back_inserter(s8));
+                    std::u16string s16;
+                    view(id32 + ends[e] + U"tail").to<utf16>(std::back_inserter(s16));
+                    CHECK(scan_identifier(view(s8)).base() == s8.data() + id8.size());
+                    CHECK(scan_identifier(view(s16)).base() == s16.data() + id16.size());
+                    CHECK(scan_identifier(view(id8)) == view(id8).end());
+                    CHECK(scan_identifier(view(id16)) == view(id16).end());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("utf/case", "case mapping and folding") {
+    SECTION("mappings", "") {
+        codepoint_type buf[max_case_mapping_length];
+        CHECK(get_case_mapping('A', cm_lower, buf) == 1);
+        CHECK(buf[0] == 'a');
+        CHECK(get_case_mapping(0x3a3, cm_lower, buf) == 1);
+        CHECK(buf[0] == 0x3c3);
+        CHECK(get_case_mapping(0xdf, cm_upper, buf) == 2);
+        CHECK((buf[0] == 'S' && buf[1] == 'S'));
+        CHECK(get_case_mapping(0xdf, cm_lower, buf) == 1);
+        CHECK(buf[0] == 0xdf);
+        CHECK(get_case_mapping(0x130, cm_lower, buf) == 2);
+        CHECK((buf[0] == 'i' && buf[1] == 0x307));
+        CHECK(get_case_mapping(0x390, cm_upper, buf) == 3);
+        CHECK(get_case_mapping(0x1e9e, cm_fold, buf) == 2);
+        CHECK((buf[0] == 's' && buf[1] == 's'));
+        CHECK(get_case_mapping(0x10400, cm_lower, buf) == 1);
+        CHECK(buf[0] == 0x10428);
+        CHECK(get_case_mapping(0x4e00, cm_upper, buf) == 1);
+        CHECK(buf[0] == 0x4e00);
+        CHECK(get_case_mapping(0x110000, cm_fold, buf) == 1);
+        CHECK(buf[0] == 0x110000);
+    }
+    SECTION("transforms", "") {
+        std::string s8 = "Stra\xc3\x9f" "e, \xce\xa3\xcf\x8e\xcf\x82 & \xf0\x90\x90\x80!";
+        std::string lower, upper, folded;
+        to_lower<utf8>(view(s8), std::back_inserter(lower));
+        to_upper<utf8>(view(s8), std::back_inserter(upper));
+        case_fold<utf8>(view(s8), std::back_inserter(folded));
+        CHECK(lower == "stra\xc3\x9f" "e, \xcf\x83\xcf\x8e\xcf\x82 & \xf0\x90\x90\xa8!");
+        CHECK(upper == "STRASSE, \xce\xa3\xce\x8f\xce\xa3 & \xf0\x90\x90\x80!");
+        CHECK(folded == "strasse, \xcf\x83\xcf\x8e\xcf\x83 & \xf0\x90\x90\xa8!");
+
+        // to another encoding, and from one
+        std::u16string upper16;
+        to_upper<utf16>(view(s8), std::back_inserter(upper16));
+        CHECK(upper16 == u"STRASSE, \u03a3\u038f\u03a3 & \U00010400!");
+        std::string from16;
+        case_fold<utf8>(view(upper16), std::back_inserter(from16));
+        CHECK(from16 == folded);
+        stringview<std::string::const_iterator> it_sv(s8.begin(), s8.end());
+        std::string it_lower;
+        to_lower<utf8>(it_sv, std::back_inserter(it_lower));
+        CHECK(it_lower == lower);
+    }
+    SECTION("ascii blocks", "") {
+        // every ASCII character, so the 8 byte path sees all boundaries
+        std::string ascii;
+        for (int c = 0; c < 0x80; ++c) { ascii += static_cast<char>(c); }
+        std::string mixed = ascii + "\xc3\x89" + ascii;
+        std::string lower, upper, expected_lower, expected_upper;
+        to_lower<utf8>(view(mixed), std::back_inserter(lower));
+        to_upper<utf8>(view(mixed), std::back_inserter(upper));
+        for (size_t i = 0; i < mixed.size(); ++i) {
+            char c = mixed[i];
+            expected_lower += c >= 'A' && c <= 'Z' ? c + 32 : c;
+            expected_upper += c >= 'a' && c <= 'z' ? c - 32 : c;
+        }
+        expected_lower.replace(0x80, 2, "\xc3\xa9");
+        CHECK(lower == expected_lower);
+        CHECK(upper == expected_upper);
+    }
+}
+
+#ifdef UTFCONV_TESTS
+namespace {
+    // a fresh temporary directory, removed with everything in it on destruction
+    struct temp_dir {
+        std::string path;
+        temp_dir() {
+            char name[] = "/tmp/utfconv_test.XXXXXX";
+            path = mkdtemp(name);
+        }
+        ~temp_dir() {
+            const char* names[] = { "in", "mid", "out", "fifo" };
+            for (size_t i = 0; i < elems(names); ++i) { unlink(file(names[i]).c_str()); }
+            rmdir(path.c_str());
+        }
+        std::string file(const char* name) const { return path + "/" + name; }
+    };
+
+    void write_file(const std::string& path, const std::string& data) {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        std::fwrite(data.data(), 1, data.size(), f);
+        std::fclose(f);
+    }
+    std::string read_file(const std::string& path) {
+        std::string res;
+        FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f) { return res; }
+        char buf[4096];
+        for (size_t n; (n = std::fread(buf, 1, sizeof(buf), f)) != 0;) { res.append(buf, n); }
+        std::fclose(f);
+        return res;
+    }
+
+    // send stderr to /dev/null for the lifetime of the object, hiding the
+    // messages of expected failures
+    struct quiet_stderr {
+        int saved;
+        quiet_stderr() : saved(dup(2)) {
+            int null = ::open("/dev/null", O_WRONLY);
+            dup2(null, 2);
+            close(null);
+        }
+        ~quiet_stderr() {
+            dup2(saved, 2);
+            close(saved);
+        }
+    };
+
+    int utfconv(std::vector<std::string> args) {
+        args.insert(args.begin(), "utfconv");
+        std::vector<char*> argv;
+        for (size_t i = 0; i < args.size(); ++i) { argv.push_back(&args[i][0]); }
+        return utfconv_main(static_cast<int>(argv.size()), argv.data());
+    }
+}
+
+TEST_CASE("utfconv", "command-line converter") {
+    temp_dir dir;
+    const std::string text = "caf\xc3\xa9 \xe4\xbd\xa0\xe5\xa5\xbd \xf0\x9f\x92\xa9\n";
+    SECTION("round trip", "") {
+        write_file(dir.file("in"), text);
+        CHECK(utfconv({ "-f", "utf8", "-t", "utf16", dir.file("in"), dir.file("mid") }) == 0);
+        std::u16string expected = u"caf\u00e9 \u4f60\u597d \U0001f4a9\n";
+        CHECK(read_file(dir.file("mid")) == std::string(reinterpret_cast<const char*>(expected.data()), expected.size() * 2));
+        CHECK(utfconv({ "-f", "utf16", "-t", "utf8", dir.file("mid"), dir.file("out") }) == 0);
+        CHECK(read_file(dir.file("out")) == text);
+    }
+    SECTION("round trip through a pipe", "") {
+        REQUIRE(mkfifo(dir.file("fifo").c_str(), 0600) == 0);
+        std::thread feeder([&]() { write_file(dir.file("fifo"), text); });
+        CHECK(utfconv({ "-t", "utf32", dir.file("fifo"), dir.file("mid") }) == 0);
+        feeder.join();
+        feeder = std::thread([&]() { write_file(dir.file("fifo"), read_file(dir.file("mid"))); });
+        CHECK(utfconv({ "-f", "utf32", "-t", "utf8", dir.file("fifo"), dir.file("out") }) == 0);
+        feeder.join();
+        CHECK(read_file(dir.file("out")) == text);
+    }
+    SECTION("several blocks through a pipe", "sequences straddle the 1 MiB block boundaries") {
+        // 9 bytes, so block boundaries fall inside the 3- and 4-byte sequences
+        std::string big;
+        for (int i = 0; i < 350000; ++i) { big += "\xe0\xa4\xa8\xf0\x9f\x92\xa9xy"; }
+        std::u16string expected;
+        view(big).to<utf16>(std::back_inserter(expected));
+        REQUIRE(mkfifo(dir.file("fifo").c_str(), 0600) == 0);
+        const char* jobs[] = { "1", "3" };
+        for (size_t j = 0; j < elems(jobs); ++j) {
+            std::thread feeder([&]() { write_file(dir.file("fifo"), big); });
+            CHECK(utfconv({ "-j", jobs[j], dir.file("fifo"), dir.file("out") }) == 0);
+            feeder.join();
+            CHECK(read_file(dir.file("out")) == std::string(reinterpret_cast<const char*>(expected.data()), expected.size() * 2));
+
+            feeder = std::thread([&]() { write_file(dir.file("fifo"), big); });
+            std::fflush(stdout);
+            int saved = dup(1);
+            int fd = ::open(dir.file("out").c_str(), O_WRONLY | O_TRUNC);
+            dup2(fd, 1);
+            close(fd);
+            int res = utfconv({ "--count", "-j", jobs[j], dir.file("fifo") });
+            std::fflush(stdout);
+            dup2(saved, 1);
+            close(saved);
+            feeder.join();
+            CHECK(res == 0);
+            CHECK(read_file(dir.file("out")) == "1400000\n");
+        }
+    }
+    SECTION("append to stdout", "a shell >> redirect keeps what the file already holds") {
+        write_file(dir.file("in"), text);
+        write_file(dir.file("out"), "log\n");
+        std::fflush(stdout);
+        int saved = dup(1);
+        int fd = ::open(dir.file("out").c_str(), O_WRONLY | O_APPEND);
+        dup2(fd, 1);
+        close(fd);
+        int res = utfconv({ "-t", "utf8", dir.file("in") });
+        dup2(saved, 1);
+        close(saved);
+        CHECK(res == 0);
+        CHECK(read_file(dir.file("out")) == "log\n" + text);
+    }
+    SECTION("several chunks to stdout", "sequences straddle the chunk boundaries") {
+        std::string big;
+        for (int i = 0; i < 20000; ++i) { big += "\xe0\xa4\xa8\xf0\x9f\x92\xa9xy"; }
+        std::u16string big16;
+        view(big).to<utf16>(std::back_inserter(big16));
+        std::u32string big32;
+        view(big).to<utf32>(std::back_inserter(big32));
+        const std::string expected[] = {
+            std::string(reinterpret_cast<const char*>(big16.data()), big16.size() * 2),
+            std::string(reinterpret_cast<const char*>(big32.data()), big32.size() * 4),
+            big,
+        };
+        const char* from[] = { "utf8", "utf8", "utf16" };
+        const char* to[] = { "utf16", "utf32", "utf8" };
+        const std::string input[] = { big, big, expected[0] };
+        for (size_t i = 0; i < elems(from); ++i) {
+            write_file(dir.file("in"), input[i]);
+            std::fflush(stdout);
+            int saved = dup(1);
+            int fd = ::open(dir.file("out").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            dup2(fd, 1);
+            close(fd);
+            int res = utfconv({ "-f", from[i], "-t", to[i], dir.file("in") });
+            dup2(saved, 1);
+            close(saved);
+            CHECK(res == 0);
+            CHECK(read_file(dir.file("out")) == expected[i]);
+        }
+    }
+    SECTION("validate", "") {
+        // Devanagari, all in U+0800-U+0FFF
+        write_file(dir.file("in"), "\xe0\xa4\xa8\xe0\xa4\xae\xe0\xa4\xb8\xe0\xa5\x8d\xe0\xa4\xa4\xe0\xa5\x87");
+        CHECK(utfconv({ "--validate-only", dir.file("in") }) == 0);
+        REQUIRE(mkfifo(dir.file("fifo").c_str(), 0600) == 0);
+        std::thread feeder([&]() { write_file(dir.file("fifo"), read_file(dir.file("in"))); });
+        CHECK(utfconv({ "--validate-only", dir.file("fifo") }) == 0);
+        feeder.join();
+    }
+    SECTION("exit codes", "") {
+        quiet_stderr quiet;
+        write_file(dir.file("in"), "ab\xc3");
+        CHECK(utfconv({ "--validate-only", dir.file("in") }) == 1);
+        CHECK(utfconv({ "--validate-only", dir.file("missing") }) == 2);
+        CHECK(utfconv({ "-t", "ebcdic", dir.file("in") }) == 2);
+        // reading a directory fails, which must not look like empty input
+        CHECK(utfconv({ "--count", dir.path }) == 2);
+        CHECK(utfconv({ dir.path, dir.file("out") }) == 2);
+        CHECK(utfconv({ dir.file("in"), dir.path }) == 1);
+        write_file(dir.file("in"), text);
+        CHECK(utfconv({ dir.file("in"), dir.path }) == 2);
+    }
+}
+#endif
+
+#ifdef __cpp_impl_coroutine
+namespace {
+    // UTF-8 test string long enough to span several generator blocks
+    std::string long_utf8() {
+        std::string res;
+        for (int i = 0; i < 300; ++i) {
+            res += "a\xc3\xb8\xe2\x82\xac\xf0\x9f\x92\xa9";
+        }
+        return res;
+    }
+
+    // hands out at most `chunk` code units per call. If fail is set,
+    // reading past the end is an error
+    struct chunked_source {
+        const char* pos;
+        const char* last;
+        size_t chunk;
+        bool fail;
+
+        ptrdiff_t operator()(char* buf, size_t n) {
+            if (fail && pos == last) { return -1; }
+            size_t len = std::min(std::min(n, chunk), static_cast<size_t>(last - pos));
+            std::copy(pos, pos + len, buf);
+            pos += len;
+            return static_cast<ptrdiff_t>(len);
+        }
+    };
+
+    // awaitable read which completes only when the test resumes it
+    std::vector<std::coroutine_handle<> > pending_reads;
+    struct deferred_read {
+        chunked_source* src;
+        char* buf;
+        size_t n;
+
+        bool await_ready() { return false; }
+        void await_suspend(std::coroutine_handle<> h) { pending_reads.push_back(h); }
+        ptrdiff_t await_resume() { return (*src)(buf, n); }
+    };
+
+    // eagerly started coroutine with no result
+    struct test_task {
+        struct promise_type {
+            test_task get_return_object() { return test_task(); }
+            std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+            std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    test_task consume(async_block_generator<codepoint_type>& gen, std::vector<codepoint_type>& out, bool& finished) {
+        for (;;) {
+            // not in the loop condition; gcc 12 miscompiles co_await there
+            bool more = co_await gen.next();
+            if (!more) { break; }
+            out.insert(out.end(), gen.block_begin(), gen.block_end());
+        }
+        finished = true;
+    }
+}
+
+TEST_CASE("utf/coro/codepoints", "generate the code points of a stringview in blocks") {
+    std::string str = long_utf8();
+    stringview<std::string::const_iterator> sv(str.begin(), str.end());
+    std::vector<codepoint_type> expected(sv.begin(), sv.end());
+
+    std::vector<codepoint_type> actual;
+    block_generator<codepoint_type> gen = codepoints(sv);
+    for (block_generator<codepoint_type>::iterator it = gen.begin(); it != gen.end(); ++it) {
+        actual.push_back(*it);
+    }
+    CHECK(actual == expected);
+
+    SECTION("blocks", "values can also be consumed a block at a time") {
+        block_generator<codepoint_type> gen2 = codepoints(sv);
+        size_t blocks = 0;
+        std::vector<codepoint_type> res;
+        while (gen2.next()) {
+            ++blocks;
+            res.insert(res.end(), gen2.block_begin(), gen2.block_end());
+        }
+        CHECK(res == expected);
+        CHECK(blocks == (expected.size() + 255) / 256);
+        CHECK(!gen2.next());
+    }
+    SECTION("empty", "") {
+        block_generator<codepoint_type> gen2 = codepoints(stringview<const char*>(str.data(), str.data()));
+        CHECK(gen2.begin() == gen2.end());
+    }
+}
+
+TEST_CASE("utf/coro/encode", "generate transcoded code units") {
+    std::string str = long_utf8();
+    stringview<std::string::const_iterator> sv(str.begin(), str.end());
+    std::vector<char16_t> expected;
+    sv.to<utf16>(std::back_inserter(expected));
+
+    block_generator<char16_t> gen = encode<utf16>(sv);
+    std::vector<char16_t> actual(gen.begin(), gen.end());
+    CHECK(actual == expected);
+}
+
+TEST_CASE("utf/coro/decode_stream", "decode code points from a pull-based source") {
+    std::string str = long_utf8();
+    stringview<std::string::const_iterator> sv(str.begin(), str.end());
+    std::vector<codepoint_type> expected(sv.begin(), sv.end());
+
+    for (size_t chunk = 1; chunk < 8; ++chunk) {
+        chunked_source src = { str.data(), str.data() + str.size(), chunk, false };
+        block_generator<codepoint_type> gen = decode_stream<utf8>(src);
+        std::vector<codepoint_type> actual(gen.begin(), gen.end());
+        CHECK(actual == expected);
+    }
+
+    SECTION("3-byte sequences below U+1000", "") {
+        std::string deva;
+        for (int i = 0; i < 300; ++i) { deva += "\xe0\xa4\xa8\xe0\xa4\xae\xe0\xa4\xb8\xe0\xa5\x8d"; }
+        stringview<std::string::const_iterator> dsv(deva.begin(), deva.end());
+        std::vector<codepoint_type> dexpected(dsv.begin(), dsv.end());
+        chunked_source src = { deva.data(), deva.data() + deva.size(), 5, false };
+        block_generator<codepoint_type> gen = decode_stream<utf8>(src);
+        std::vector<codepoint_type> actual(gen.begin(), gen.end());
+        CHECK(actual == dexpected);
+        CHECK(!gen.failed());
+    }
+    SECTION("truncated input", "an incomplete trailing sequence is an error") {
+        chunked_source src = { str.data(), str.data() + str.size() - 1, 1000, false };
+        block_generator<codepoint_type> gen = decode_stream<utf8>(src);
+        std::vector<codepoint_type> actual(gen.begin(), gen.end());
+        CHECK(actual.size() == expected.size() - 1);
+        CHECK(std::equal(actual.begin(), actual.end(), expected.begin()));
+        CHECK(gen.failed());
+    }
+    SECTION("malformed input", "") {
+        std::string bad = "ab\xff" "cd";
+        chunked_source src = { bad.data(), bad.data() + bad.size(), 1000, false };
+        block_generator<codepoint_type> gen = decode_stream<utf8>(src);
+        CHECK(gen.begin() == gen.end());
+        CHECK(gen.failed());
+    }
+    SECTION("source error", "") {
+        chunked_source src = { str.data(), str.data() + 100, 7, true };
+        block_generator<codepoint_type> gen = decode_stream<utf8>(src);
+        std::vector<codepoint_type> actual(gen.begin(), gen.end());
+        CHECK(!actual.empty());
+        CHECK(gen.failed());
+    }
+}
+
+TEST_CASE("utf/coro/decode_stream_async", "decode code points from an asynchronous source") {
+    std::string str = long_utf8();
+    stringview<std::string::const_iterator> sv(str.begin(), str.end());
+    std::vector<codepoint_type> expected(sv.begin(), sv.end());
+
+    chunked_source src = { str.data(), str.data() + str.size(), 5, false };
+    async_block_generator<codepoint_type> gen = decode_stream_async<utf8>([&src](char* buf, size_t n) {
+        deferred_read r = { &src, buf, n };
+        return r;
+    });
+
+    std::vector<codepoint_type> actual;
+    bool finished = false;
+    consume(gen, actual, finished);
+    // nothing happens until each read completes
+    while (!pending_reads.empty()) {
+        CHECK(!finished);
+        std::coroutine_handle<> h = pending_reads.back();
+        pending_reads.pop_back();
+        h.resume();
+    }
+    CHECK(finished);
+    CHECK(actual == expected);
+    CHECK(!gen.failed());
+
+    SECTION("3-byte sequences below U+1000", "") {
+        std::string deva;
+        for (int i = 0; i < 100; ++i) { deva += "\xe0\xa4\xa8\xe0\xa4\xae\xe0\xa4\xb8\xe0\xa5\x8d"; }
+        chunked_source dsrc = { deva.data(), deva.data() + deva.size(), 7, false };
+        async_block_generator<codepoint_type> gen2 = decode_stream_async<utf8>([&dsrc](char* buf, size_t n) {
+            deferred_read r = { &dsrc, buf, n };
+            return r;
+        });
+        std::vector<codepoint_type> res;
+        bool done = false;
+        consume(gen2, res, done);
+        while (!pending_reads.empty()) {
+            std::coroutine_handle<> h = pending_reads.back();
+            pending_reads.pop_back();
+            h.resume();
+        }
+        CHECK(done);
+        CHECK(res.size() == 400);
+        CHECK(res[0] == 0x0928);
+        CHECK(!gen2.failed());
+    }
+
+    SECTION("source error", "") {
+        chunked_source failing = { str.data(), str.data() + 10, 5, true };
+        async_block_generator<codepoint_type> gen2 = decode_stream_async<utf8>([&failing](char* buf, size_t n) {
+            deferred_read r = { &failing, buf, n };
+            return r;
+        });
+        std::vector<codepoint_type> res;
+        bool done = false;
+        consume(gen2, res, done);
+        while (!pending_reads.empty()) {
+            std::coroutine_handle<> h = pending_reads.back();
+            pending_reads.pop_back();
+            h.resume();
+        }
+        CHECK(done);
+        CHECK(gen2.failed());
+    }
+}
+#endif
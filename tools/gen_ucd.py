@@ -0,0 +1,528 @@
+#!/usr/bin/env python3
+#          Copyright Jesper Dam 2013.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Generates utf_ucd.hpp, the Unicode property tables used by utf_unicode.hpp.
+#
+#     python3 tools/gen_ucd.py [--ucd DIR] [--fetch] [-o utf_ucd.hpp]
+#
+# Properties are read only from the published Unicode Character Database
+# files in tools/ucd, or in DIR: UnicodeData.txt, EastAsianWidth.txt,
+# Scripts.txt, PropList.txt, DerivedCoreProperties.txt,
+# GraphemeBreakProperty.txt, emoji-data.txt, SpecialCasing.txt and
+# CaseFolding.txt. --fetch downloads the missing ones from unicode.org,
+# unmodified. The files are pinned by UCD_VERSION and the SHA-256
+# checksums in UCD_FILES, and the script refuses to run on a file that
+# doesn't match or has no checksum, so the header is the same whichever
+# machine or Python version generates it. To move to another Unicode
+# version, replace the files and update both.
+#
+# Code points a file doesn't list get the property's default value, which
+# is applied here rather than read from the files' @missing lines.
+#
+# Each property becomes a three-stage lookup table: the code point is split
+# into three bit fields, and each field indexes into a table of
+# deduplicated blocks of the next stage. The split is picked to make the
+# tables as small as possible.
+
+import argparse
+import hashlib
+import os
+import sys
+import urllib.request
+
+MAX_CODEPOINT = 0x10ffff
+
+UCD_VERSION = '14.0.0'
+
+UCD_URL = 'https://www.unicode.org/Public/%s/ucd/' % UCD_VERSION
+
+# SHA-256 of each file. None marks a file that isn't vendored yet: fetch
+# it, check it against the published one and pin its checksum here
+UCD_FILES = {
+    'CaseFolding.txt': None,
+    'DerivedCoreProperties.txt': None,
+    'EastAsianWidth.txt': None,
+    'GraphemeBreakProperty.txt': None,
+    'PropList.txt': None,
+    'Scripts.txt': None,
+    'SpecialCasing.txt': 'c667b45908fd269af25fd55d2fc5bbc157fb1b77675936e25c513ce32e080334',
+    'UnicodeData.txt': None,
+    'emoji-data.txt': None,
+}
+# paths below UCD_URL, where they aren't the name
+UCD_PATHS = {'emoji-data.txt': 'emoji/emoji-data.txt'}
+
+# Script values, as named in Scripts.txt
+SCRIPTS = [
+    'Unknown', 'Common', 'Inherited',
+    'Adlam', 'Ahom', 'Anatolian_Hieroglyphs', 'Arabic', 'Armenian', 'Avestan', 'Balinese', 'Bamum',
+    'Bassa_Vah', 'Batak', 'Bengali', 'Bhaiksuki', 'Bopomofo', 'Brahmi', 'Braille', 'Buginese', 'Buhid',
+    'Canadian_Aboriginal', 'Carian', 'Caucasian_Albanian', 'Chakma', 'Cham', 'Cherokee', 'Chorasmian',
+    'Coptic', 'Cuneiform', 'Cypriot', 'Cypro_Minoan', 'Cyrillic', 'Deseret', 'Devanagari', 'Dives_Akuru',
+    'Dogra', 'Duployan', 'Egyptian_Hieroglyphs', 'Elbasan', 'Elymaic', 'Ethiopic', 'Georgian',
+    'Glagolitic', 'Gothic', 'Grantha', 'Greek', 'Gujarati', 'Gunjala_Gondi', 'Gurmukhi', 'Han', 'Hangul',
+    'Hanifi_Rohingya', 'Hanunoo', 'Hatran', 'Hebrew', 'Hiragana', 'Imperial_Aramaic',
+    'Inscriptional_Pahlavi', 'Inscriptional_Parthian', 'Javanese', 'Kaithi', 'Kannada', 'Katakana',
+    'Kayah_Li', 'Kharoshthi', 'Khitan_Small_Script', 'Khmer', 'Khojki', 'Khudawadi', 'Lao', 'Latin',
+    'Lepcha', 'Limbu', 'Linear_A', 'Linear_B', 'Lisu', 'Lycian', 'Lydian', 'Mahajani', 'Makasar',
+    'Malayalam', 'Mandaic', 'Manichaean', 'Marchen', 'Masaram_Gondi', 'Medefaidrin', 'Meetei_Mayek',
+    'Mende_Kikakui', 'Meroitic_Cursive', 'Meroitic_Hieroglyphs', 'Miao', 'Modi', 'Mongolian', 'Mro',
+    'Multani', 'Myanmar', 'Nabataean', 'Nandinagari', 'New_Tai_Lue', 'Newa', 'Nko', 'Nushu',
+    'Nyiakeng_Puachue_Hmong', 'Ogham', 'Ol_Chiki', 'Old_Hungarian', 'Old_Italic', 'Old_North_Arabian',
+    'Old_Permic', 'Old_Persian', 'Old_Sogdian', 'Old_South_Arabian', 'Old_Turkic', 'Old_Uyghur', 'Oriya',
+    'Osage', 'Osmanya', 'Pahawh_Hmong', 'Palmyrene', 'Pau_Cin_Hau', 'Phags_Pa', 'Phoenician',
+    'Psalter_Pahlavi', 'Rejang', 'Runic', 'Samaritan', 'Saurashtra', 'Sharada', 'Shavian', 'Siddham',
+    'SignWriting', 'Sinhala', 'Sogdian', 'Sora_Sompeng', 'Soyombo', 'Sundanese', 'Syloti_Nagri',
+    'Syriac', 'Tagalog', 'Tagbanwa', 'Tai_Le', 'Tai_Tham', 'Tai_Viet', 'Takri', 'Tamil', 'Tangsa',
+    'Tangut', 'Telugu', 'Thaana', 'Thai', 'Tibetan', 'Tifinagh', 'Tirhuta', 'Toto', 'Ugaritic', 'Vai',
+    'Vithkuqi', 'Wancho', 'Warang_Citi', 'Yezidi', 'Yi', 'Zanabazar_Square',
+]
+
+
+# ---- reading UCD files -----------------------------------------------------
+
+def fetch_ucd(ucd):
+    """download the files missing from ucd, as published"""
+    for name in sorted(UCD_FILES):
+        path = os.path.join(ucd, name)
+        if not os.path.exists(path):
+            print('fetching %s' % name, file=sys.stderr)
+            with urllib.request.urlopen(UCD_URL + UCD_PATHS.get(name, name)) as r, open(path, 'wb') as f:
+                f.write(r.read())
+
+def check_ucd(ucd):
+    """exit unless every file in ucd is the pinned one"""
+    for name, digest in sorted(UCD_FILES.items()):
+        path = os.path.join(ucd, name)
+        if not os.path.exists(path):
+            sys.exit('%s: missing, run with --fetch' % path)
+        with open(path, 'rb') as f:
+            actual = hashlib.sha256(f.read()).hexdigest()
+        if digest is None:
+            sys.exit('%s: no checksum pinned in UCD_FILES; check it against %s and pin %s'
+                     % (path, UCD_URL + UCD_PATHS.get(name, name), actual))
+        if actual != digest:
+            sys.exit('%s: not the pinned Unicode %s file' % (path, UCD_VERSION))
+
+def parse_range(field):
+    r = field.split('..')
+    return int(r[0], 16), int(r[-1], 16)
+
+def read_ucd(path):
+    """(first, last, value) for each line of a UCD property file"""
+    res = []
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = [x.strip() for x in line.split(';')]
+            res.append(parse_range(fields[0]) + (fields[1],))
+    return res
+
+def ranges_with(entries, value):
+    return [(first, last) for first, last, v in entries if v == value]
+
+# ---- property derivation ---------------------------------------------------
+
+def fill(values, ranges, value):
+    for first, last in ranges:
+        for c in range(first, last + 1):
+            values[c] = value
+
+GRAPHEME_BREAK = ['other', 'cr', 'lf', 'control', 'extend', 'zwj', 'regional_indicator',
+                  'prepend', 'spacing_mark', 'l', 'v', 't', 'lv', 'lvt', 'extended_pictographic']
+GRAPHEME_BREAK_UCD = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator',
+                      'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT']
+
+def grapheme_break(ucd):
+    values = [0] * (MAX_CODEPOINT + 1)
+    entries = read_ucd(os.path.join(ucd, 'GraphemeBreakProperty.txt'))
+    for i, name in enumerate(GRAPHEME_BREAK_UCD):
+        fill(values, ranges_with(entries, name), i)
+    pictographic = ranges_with(read_ucd(os.path.join(ucd, 'emoji-data.txt')), 'Extended_Pictographic')
+    # Extended_Pictographic only applies to code points which are otherwise
+    # Other, so it fits in the same table
+    for first, last in pictographic:
+        for c in range(first, last + 1):
+            assert values[c] == 0, hex(c)
+            values[c] = GRAPHEME_BREAK.index('extended_pictographic')
+    return values
+
+GENERAL_CATEGORY = ['Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd',
+                    'Ps', 'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co']
+
+def general_category(ucd):
+    values = [0] * (MAX_CODEPOINT + 1)
+    # ranges are given as <..., First> and <..., Last> pairs
+    first = None
+    with open(os.path.join(ucd, 'UnicodeData.txt'), encoding='utf-8') as f:
+        for line in f:
+            fields = line.split(';')
+            c = int(fields[0], 16)
+            gc = GENERAL_CATEGORY.index(fields[2])
+            if fields[1].endswith(', First>'):
+                first = c
+                continue
+            fill(values, [(first if first is not None else c, c)], gc)
+            first = None
+    return values
+
+EAST_ASIAN_WIDTH = ['N', 'A', 'H', 'W', 'F', 'Na']
+
+# UAX #11: code points not listed in EastAsianWidth.txt are N, except in
+# the CJK ideograph blocks and planes 2 and 3, where they are W
+EAST_ASIAN_WIDTH_DEFAULTS = [
+    (0x3400, 0x4dbf), (0x4e00, 0x9fff), (0xf900, 0xfaff), (0x20000, 0x2fffd), (0x30000, 0x3fffd),
+]
+
+def east_asian_width(ucd):
+    values = [0] * (MAX_CODEPOINT + 1)
+    fill(values, EAST_ASIAN_WIDTH_DEFAULTS, EAST_ASIAN_WIDTH.index('W'))
+    for first, last, v in read_ucd(os.path.join(ucd, 'EastAsianWidth.txt')):
+        fill(values, [(first, last)], EAST_ASIAN_WIDTH.index(v))
+    return values
+
+def script(ucd):
+    values = [0] * (MAX_CODEPOINT + 1)
+    for first, last, v in read_ucd(os.path.join(ucd, 'Scripts.txt')):
+        if v not in SCRIPTS:
+            sys.exit('unknown script %s: add it to SCRIPTS' % v)
+        fill(values, [(first, last)], SCRIPTS.index(v))
+    return values
+
+BINARY_PROPERTIES = ['white_space', 'uppercase', 'lowercase', 'xid_start', 'xid_continue',
+                     'default_ignorable', 'extended_pictographic']
+BINARY_PROPERTIES_UCD = ['White_Space', 'Uppercase', 'Lowercase', 'XID_Start', 'XID_Continue',
+                         'Default_Ignorable_Code_Point', 'Extended_Pictographic']
+
+def binary_properties(ucd):
+    """a bit mask of BINARY_PROPERTIES for each code point"""
+    values = [0] * (MAX_CODEPOINT + 1)
+    entries = []
+    for name in ('PropList.txt', 'DerivedCoreProperties.txt', 'emoji-data.txt'):
+        entries += read_ucd(os.path.join(ucd, name))
+    for i, name in enumerate(BINARY_PROPERTIES_UCD):
+        for first, last in ranges_with(entries, name):
+            for c in range(first, last + 1):
+                values[c] |= 1 << i
+    return values
+
+def display_width(gc, eaw, binary, gcb):
+    """columns taken up in a terminal: 0, 1 or 2"""
+    zero_gc = set(GENERAL_CATEGORY.index(x) for x in ('Mn', 'Me', 'Cf', 'Cc', 'Zl', 'Zp'))
+    wide = (EAST_ASIAN_WIDTH.index('W'), EAST_ASIAN_WIDTH.index('F'))
+    ignorable = 1 << BINARY_PROPERTIES.index('default_ignorable')
+    # Hangul vowel and final jamo combine with the preceding syllable
+    jamo = (GRAPHEME_BREAK.index('v'), GRAPHEME_BREAK.index('t'))
+    values = [1] * (MAX_CODEPOINT + 1)
+    for c in range(MAX_CODEPOINT + 1):
+        if gc[c] in zero_gc or binary[c] & ignorable or gcb[c] in jamo:
+            values[c] = 0
+        elif eaw[c] in wide:
+            values[c] = 2
+    return values
+
+CASE_MAPPINGS = ['lower', 'upper', 'fold']
+
+def case_mappings(ucd):
+    """{c: (lower, upper, fold)} for each code point with a full case mapping
+    other than itself, each mapping a tuple of code points. Mappings which
+    depend on context or language are left out"""
+    res = {}
+    simple = {}
+    with open(os.path.join(ucd, 'UnicodeData.txt'), encoding='utf-8') as f:
+        for line in f:
+            fields = line.split(';')
+            c = int(fields[0], 16)
+            upper = (int(fields[12], 16),) if fields[12] else (c,)
+            lower = (int(fields[13], 16),) if fields[13].strip() else (c,)
+            simple[c] = [lower, upper, (c,)]
+    def parse(path):
+        with open(path, encoding='utf-8') as f:
+            for line in f:
+                line = line.split('#', 1)[0].strip()
+                if line:
+                    yield [x.strip() for x in line.split(';')]
+    def points(field):
+        return tuple(int(x, 16) for x in field.split())
+    for fields in parse(os.path.join(ucd, 'SpecialCasing.txt')):
+        # conditional mappings have a fifth field
+        if len(fields) > 4 and fields[4]:
+            continue
+        c = int(fields[0], 16)
+        simple.setdefault(c, [(c,), (c,), (c,)])
+        simple[c][0] = points(fields[1])
+        simple[c][1] = points(fields[3])
+    for fields in parse(os.path.join(ucd, 'CaseFolding.txt')):
+        if fields[1] in ('C', 'F'):
+            c = int(fields[0], 16)
+            simple.setdefault(c, [(c,), (c,), (c,)])
+            simple[c][2] = points(fields[2])
+    for c, maps in simple.items():
+        if any(m != (c,) for m in maps):
+            res[c] = tuple(maps)
+    return res
+
+# case records at or above this refer to case_special rather than a delta
+CASE_SPECIAL = 0x200000
+
+def case_table(mappings):
+    """a record index for each code point, the records of (lower, upper,
+    fold) values, and the length-prefixed mappings to several code points.
+    Each record value is either the difference between the mapped code point
+    and the original, or CASE_SPECIAL plus an offset into the special list"""
+    values = [0] * (MAX_CODEPOINT + 1)
+    records = [(0, 0, 0)]
+    record_index = {records[0]: 0}
+    special = []
+    special_index = {}
+    for c in sorted(mappings):
+        rec = []
+        for m in mappings[c]:
+            if len(m) == 1:
+                rec.append(m[0] - c)
+                continue
+            if m not in special_index:
+                special_index[m] = len(special)
+                special += [len(m)] + list(m)
+            rec.append(CASE_SPECIAL + special_index[m])
+        rec = tuple(rec)
+        if rec not in record_index:
+            record_index[rec] = len(records)
+            records.append(rec)
+        values[c] = record_index[rec]
+    return values, records, special
+
+# ---- table generation ------------------------------------------------------
+
+def index_type(n):
+    return 'uint8_t' if n <= 0x100 else 'uint16_t'
+
+def type_size(t):
+    return 1 if t == 'uint8_t' else 2
+
+def dedup(values, size):
+    """split values into blocks of size, returning (index per block, unique blocks)"""
+    blocks = {}
+    order = []
+    index = []
+    for i in range(0, len(values), size):
+        b = tuple(values[i:i + size])
+        if b not in blocks:
+            blocks[b] = len(order)
+            order.append(b)
+        index.append(blocks[b])
+    return index, order
+
+def three_stage(values):
+    """the smallest (shift2, shift3, stage1, stage2, stage3) table for values"""
+    value_size = type_size(index_type(max(values) + 1))
+    best = None
+    for shift3 in range(2, 10):
+        index3, blocks3 = dedup(values, 1 << shift3)
+        stage3 = [v for b in blocks3 for v in b]
+        for shift2 in range(1, 10):
+            if len(index3) % (1 << shift2):
+                continue
+            index2, blocks2 = dedup(index3, 1 << shift2)
+            stage2 = [v for b in blocks2 for v in b]
+            size = (len(index2) * type_size(index_type(len(blocks2)))
+                    + len(stage2) * type_size(index_type(len(blocks3)))
+                    + len(stage3) * value_size)
+            if best is None or size < best[0]:
+                best = (size, shift2, shift3, index2, stage2, stage3)
+    return best[1:]
+
+def emit_array(out, name, ctype, values):
+    out.append('            static constexpr %s %s[%d] = {' % (ctype, name, len(values)))
+    for i in range(0, len(values), 24):
+        out.append('                ' + ','.join(str(v) for v in values[i:i + 24]) + ',')
+    out.append('            };')
+
+def emit_table(name, values):
+    """declarations and definitions for a three-stage table, and the lookup expression"""
+    shift2, shift3, stage1, stage2, stage3 = three_stage(values)
+    t1 = index_type(max(stage1) + 1)
+    t2 = index_type(max(stage2) + 1)
+    t3 = index_type(max(stage3) + 1)
+    decl = []
+    emit_array(decl, name + '_stage1', t1, stage1)
+    emit_array(decl, name + '_stage2', t2, stage2)
+    emit_array(decl, name + '_stage3', t3, stage3)
+    defs = ['        template <typename T> constexpr %s ucd_tables<T>::%s_stage%d[%d];' % (t, name, i + 1, n)
+            for i, (t, n) in enumerate([(t1, len(stage1)), (t2, len(stage2)), (t3, len(stage3))])]
+    m2 = (1 << shift2) - 1
+    m3 = (1 << shift3) - 1
+    tbl = 'internal::ucd_tables<void>::' + name
+    lookup = ('%s_stage3[(%s_stage2[(%s_stage1[c >> %d] << %d) | ((c >> %d) & %d)] << %d) | (c & %d)]'
+              % (tbl, tbl, tbl, shift2 + shift3, shift2, shift3, m2, shift3, m3))
+    size = len(stage1) * type_size(t1) + len(stage2) * type_size(t2) + len(stage3) * type_size(t3)
+    return decl, defs, lookup, size
+
+HEADER = '''//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Unicode %(version)s character properties. Requires C++11.
+//
+// Generated by tools/gen_ucd.py. Do not edit.
+
+#ifndef NP_UTF_UCD_HPP
+#define NP_UTF_UCD_HPP
+
+#include "utf.hpp"
+
+namespace utf {
+'''
+
+def enum(name, prefix, names, comments=None):
+    lines = ['    enum %s {' % name]
+    for i, n in enumerate(names):
+        line = '        %s_%s,' % (prefix, n.lower())
+        if comments:
+            line += ' // ' + comments[i]
+        lines.append(line)
+    lines.append('    };')
+    return lines
+
+def lookup_function(out, comment, rtype, name, table, default):
+    out.append('')
+    out.append('    // ' + comment)
+    out.append('    constexpr %s %s(codepoint_type c) {' % (rtype, name))
+    out.append('        return c > 0x10ffff ? %s : static_cast<%s>(%s);' % (default, rtype, table))
+    out.append('    }')
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--ucd', default=os.path.join(os.path.dirname(__file__), 'ucd'), help='directory holding the UCD files')
+    parser.add_argument('--fetch', action='store_true', help='download missing UCD files from unicode.org')
+    parser.add_argument('-o', '--output', default=os.path.join(os.path.dirname(__file__), '..', 'utf_ucd.hpp'))
+    args = parser.parse_args()
+
+    if args.fetch:
+        fetch_ucd(args.ucd)
+    check_ucd(args.ucd)
+
+    gc = general_category(args.ucd)
+    eaw = east_asian_width(args.ucd)
+    binary = binary_properties(args.ucd)
+    gcb = grapheme_break(args.ucd)
+    mappings = case_mappings(args.ucd)
+    case_index, case_records, case_special = case_table(mappings)
+    case_max_len = max(len(m) for maps in mappings.values() for m in maps)
+    tables = [
+        ('general_category', gc),
+        ('script', script(args.ucd)),
+        ('east_asian_width', eaw),
+        ('binary_properties', binary),
+        ('grapheme_break', gcb),
+        ('display_width', display_width(gc, eaw, binary, gcb)),
+        ('case', case_index),
+    ]
+
+    out = (HEADER % {'version': UCD_VERSION}).rstrip('\n').split('\n')
+    out.append('    inline const char* ucd_version() { return "%s"; }' % UCD_VERSION)
+    out.append('')
+    out += enum('general_category', 'gc', GENERAL_CATEGORY)
+    out.append('')
+    out += enum('script', 'sc', SCRIPTS)
+    out.append('')
+    out += enum('east_asian_width', 'eaw', ['neutral', 'ambiguous', 'halfwidth', 'wide', 'fullwidth', 'narrow'])
+    out.append('')
+    out.append('    enum binary_property {')
+    for i, p in enumerate(BINARY_PROPERTIES):
+        out.append('        prop_%s = %d,' % (p, 1 << i))
+    out.append('    };')
+    out.append('')
+    out += enum('grapheme_break', 'gcb', GRAPHEME_BREAK)
+    out.append('')
+    out += enum('case_mapping', 'cm', CASE_MAPPINGS)
+    out.append('')
+    out.append('    namespace internal {')
+    out.append('        // a class template, so the tables can be defined in a header')
+    out.append('        template <typename T>')
+    out.append('        struct ucd_tables {')
+    lookups = {}
+    all_defs = []
+    total = 0
+    for name, values in tables:
+        decl, defs, lookup, size = emit_table(name, values)
+        out += decl
+        all_defs += defs
+        lookups[name] = lookup
+        total += size
+        print('%s: %d bytes' % (name, size), file=sys.stderr)
+    out.append('            static constexpr int32_t case_records[%d][3] = {' % len(case_records))
+    for i in range(0, len(case_records), 8):
+        out.append('                ' + ','.join('{%d,%d,%d}' % r for r in case_records[i:i + 8]) + ',')
+    out.append('            };')
+    emit_array(out, 'case_special', 'codepoint_type', case_special)
+    all_defs.append('        template <typename T> constexpr int32_t ucd_tables<T>::case_records[%d][3];' % len(case_records))
+    all_defs.append('        template <typename T> constexpr codepoint_type ucd_tables<T>::case_special[%d];' % len(case_special))
+    size = len(case_records) * 12 + len(case_special) * 4
+    total += size
+    print('case mappings: %d bytes' % size, file=sys.stderr)
+    out.append('        };')
+    out += all_defs
+    out.append('    }')
+    lookup_function(out, 'General_Category', 'general_category', 'get_general_category', lookups['general_category'], 'gc_cn')
+    lookup_function(out, 'Script', 'script', 'get_script', lookups['script'], 'sc_unknown')
+    lookup_function(out, 'East_Asian_Width', 'east_asian_width', 'get_east_asian_width', lookups['east_asian_width'], 'eaw_neutral')
+    lookup_function(out, 'Grapheme_Cluster_Break, with Extended_Pictographic folded in', 'grapheme_break', 'get_grapheme_break', lookups['grapheme_break'], 'gcb_other')
+    out.append('')
+    out.append('    // Number of terminal columns taken up by c: 2 for wide and fullwidth')
+    out.append('    // characters, 0 for combining marks, format and control characters,')
+    out.append('    // and 1 for everything else')
+    out.append('    constexpr unsigned get_display_width(codepoint_type c) {')
+    out.append('        return c > 0x10ffff ? 1 : %s;' % lookups['display_width'])
+    out.append('    }')
+    out.append('')
+    out.append('    // all the binary properties of c, as a mask of binary_property values')
+    out.append('    constexpr unsigned get_binary_properties(codepoint_type c) {')
+    out.append('        return c > 0x10ffff ? 0 : %s;' % lookups['binary_properties'])
+    out.append('    }')
+    out.append('    constexpr bool has_property(codepoint_type c, binary_property p) {')
+    out.append('        return (get_binary_properties(c) & p) != 0;')
+    out.append('    }')
+    out.append('')
+    # the special list is what get_case_mapping copies out, so check the
+    # constant against it rather than against the mappings it came from
+    i = 0
+    special_max_len = 1
+    while i < len(case_special):
+        special_max_len = max(special_max_len, case_special[i])
+        i += case_special[i] + 1
+    assert special_max_len == case_max_len, (special_max_len, case_max_len)
+    out.append('    // the most code points a single code point is mapped to by')
+    out.append('    // get_case_mapping')
+    out.append('    constexpr unsigned max_case_mapping_length = %d;' % case_max_len)
+    out.append('')
+    out.append('    // The full lowercase mapping, uppercase mapping or case folding of c,')
+    out.append('    // leaving out the mappings which depend on context or language.')
+    out.append('    // Writes the mapped code points, at most max_case_mapping_length, to')
+    out.append('    // dest and returns how many there are')
+    out.append('    inline unsigned get_case_mapping(codepoint_type c, case_mapping m, codepoint_type* dest) {')
+    out.append('        const int32_t v = c > 0x10ffff ? 0 : internal::ucd_tables<void>::case_records[%s][m];' % lookups['case'])
+    out.append('        if (v < 0x%x) {' % CASE_SPECIAL)
+    out.append('            *dest = c + v;')
+    out.append('            return 1;')
+    out.append('        }')
+    out.append('        const codepoint_type* s = internal::ucd_tables<void>::case_special + (v - 0x%x);' % CASE_SPECIAL)
+    out.append('        for (unsigned i = 0; i < s[0]; ++i) { dest[i] = s[i + 1]; }')
+    out.append('        return s[0];')
+    out.append('    }')
+    out.append('}')
+    out.append('')
+    out.append('#endif')
+
+    print('total: %d bytes' % total, file=sys.stderr)
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+    main()
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cassert>
+#include <cstring>
 #include <stdint.h>
 #include <iterator>
 
@@ -69,6 +70,8 @@ namespace utf {
 
                 return 1;
             }
+            // true if c can't start a code point
+            static bool is_continuation(codeunit_type c) { return (c & 0xc0) == 0x80; }
             static size_t write_length(codepoint_type c) {
                 if (c <= 0x7f) { return 1; }
                 if (c < 0x0800) { return 2; }
@@ -113,7 +116,8 @@ namespace utf {
                         if (((unsigned char)*first) <= 0xc1) { return false; }
                         break;
                     case 3:
-                        if (((unsigned char)*first) == 0xe0) { return false; }
+                        if (((unsigned char)*first) == 0xe0
+                            && ((unsigned char)first[1]) < 0xa0) { return false; }
                         break;
                     case 4:
                         if (((unsigned char)*first) == 0xf0
@@ -189,6 +193,7 @@ namespace utf {
                 if (c < 0x010000) { return 1; }
                 return 1;
             }
+            static bool is_continuation(codeunit_type c) { return c >= 0xdc00 && c < 0xe000; }
             static size_t write_length(codepoint_type c) {
                 if (c < 0xd800) { return 1; }
                 if (c < 0xe000) { return 0; }
@@ -264,6 +269,7 @@ namespace utf {
         struct utf_traits<utf32> {
             typedef char32_t codeunit_type;
             static size_t read_length(codeunit_type c) { return 1; }
+            static bool is_continuation(codeunit_type) { return false; }
             static size_t write_length(codepoint_type c) {
                 if (c < 0xd800) { return 1; }
                 if (c < 0xe000) { return 0; }
@@ -288,6 +294,102 @@ namespace utf {
                 return *c;
             }
         };
+
+        // Bulk operations over a range of code units. The general case
+        // handles one code point at a time, the specializations for pointers
+        // take fast paths over runs of code units that each encode a code
+        // point by themselves.
+        template <typename E, typename Iter>
+        struct bulk {
+            typedef utf_traits<E> traits_t;
+
+            // decode at most max code points from [first, last) into dest
+            static Iter decode(Iter first, Iter last, codepoint_type* dest, size_t max, size_t& count) {
+                size_t n = 0;
+                for (; n < max && first != last; ++n) {
+                    dest[n] = traits_t::decode(first);
+                    first += traits_t::read_length(*first);
+                }
+                count = n;
+                return first;
+            }
+        };
+
+        // true if all 8 bytes at p are ASCII
+        template <typename T>
+        bool ascii8(const T* p) {
+            uint64_t w;
+            std::memcpy(&w, p, sizeof(w));
+            return (w & 0x8080808080808080ULL) == 0;
+        }
+
+        // true if none of the 8 code units at p are surrogates
+        template <typename T>
+        bool bmp8(const T* p) {
+            unsigned surrogates = 0;
+            for (size_t i = 0; i < 8; ++i) {
+                surrogates |= (static_cast<uint16_t>(p[i]) & 0xf800) == 0xd800;
+            }
+            return surrogates == 0;
+        }
+
+        template <typename T>
+        struct bulk<utf8, T*> {
+            typedef utf_traits<utf8> traits_t;
+
+            static T* decode(T* first, T* last, codepoint_type* dest, size_t max, size_t& count) {
+                size_t n = 0;
+                while (n < max && first != last) {
+                    while (max - n >= 8 && last - first >= 8 && ascii8(first)) {
+                        for (size_t i = 0; i < 8; ++i) {
+                            dest[n + i] = static_cast<unsigned char>(first[i]);
+                        }
+                        n += 8;
+                        first += 8;
+                    }
+                    if (n == max || first == last) { break; }
+                    dest[n++] = traits_t::decode(first);
+                    first += traits_t::read_length(*first);
+                }
+                count = n;
+                return first;
+            }
+        };
+
+        template <typename T>
+        struct bulk<utf16, T*> {
+            typedef utf_traits<utf16> traits_t;
+
+            static T* decode(T* first, T* last, codepoint_type* dest, size_t max, size_t& count) {
+                size_t n = 0;
+                while (n < max && first != last) {
+                    while (max - n >= 8 && last - first >= 8 && bmp8(first)) {
+                        for (size_t i = 0; i < 8; ++i) {
+                            dest[n + i] = static_cast<uint16_t>(first[i]);
+                        }
+                        n += 8;
+                        first += 8;
+                    }
+                    if (n == max || first == last) { break; }
+                    dest[n++] = traits_t::decode(first);
+                    first += traits_t::read_length(*first);
+                }
+                count = n;
+                return first;
+            }
+        };
+
+        template <typename T>
+        struct bulk<utf32, T*> {
+            static T* decode(T* first, T* last, codepoint_type* dest, size_t max, size_t& count) {
+                size_t n = static_cast<size_t>(last - first) < max ? static_cast<size_t>(last - first) : max;
+                for (size_t i = 0; i < n; ++i) {
+                    dest[i] = first[i];
+                }
+                count = n;
+                return first + n;
+            }
+        };
     }
     
     template <typename It>
@@ -305,6 +407,11 @@ namespace utf {
         explicit codepoint_iterator() : val(), pos() {}
         explicit codepoint_iterator(It pos) : val(), pos(pos) {}
         codepoint_iterator(const codepoint_iterator& it) : val(it.val), pos(it.pos) {}
+        codepoint_iterator& operator = (const codepoint_iterator& it) {
+            val = it.val;
+            pos = it.pos;
+            return *this;
+        }
 
         typename std::iterator_traits<codepoint_iterator>::reference operator*() {
             val = traits_type::decode(pos);
@@ -323,8 +430,52 @@ namespace utf {
         }
         friend bool operator != (codepoint_iterator lhs, codepoint_iterator rhs) { return lhs.pos != rhs.pos; }
         friend bool operator == (codepoint_iterator lhs, codepoint_iterator rhs) { return !(lhs != rhs); }
+
+        // the underlying code unit iterator
+        It base() const { return pos; }
     };
 
+    // Decode up to N code points, starting at pos and stopping at last, into
+    // buf. count is set to the number of code points decoded, and the
+    // position following the last of them is returned. Lets downstream code
+    // work on dense arrays of code points rather than one at a time.
+    template <typename It, size_t N>
+    codepoint_iterator<It> decode_block(codepoint_iterator<It> pos, codepoint_iterator<It> last, codepoint_type (&buf)[N], size_t& count) {
+        typedef typename internal::native_encoding<typename std::iterator_traits<It>::value_type>::type encoding;
+        return codepoint_iterator<It>(internal::bulk<encoding, It>::decode(pos.base(), last.base(), buf, N, count));
+    }
+
+    namespace internal {
+        // number of code points decoded at a time by the internal iteration
+        // primitives
+        static const size_t block_size = 64;
+
+        template <typename It, typename F>
+        void for_each_block(codepoint_iterator<It> first, codepoint_iterator<It> last, F& f) {
+            codepoint_type buf[block_size];
+            while (first != last) {
+                size_t n = 0;
+                first = decode_block(first, last, buf, n);
+                for (size_t i = 0; i < n; ++i) {
+                    f(buf[i]);
+                }
+            }
+        }
+
+        template <typename EDest, typename OutIt>
+        struct encoder {
+            OutIt dest;
+            void operator()(codepoint_type c) { dest = utf_traits<EDest>::encode(c, dest); }
+        };
+
+        template <typename EDest, typename OutIt, typename F>
+        struct transform_encoder {
+            OutIt dest;
+            F f;
+            void operator()(codepoint_type c) { dest = utf_traits<EDest>::encode(f(c), dest); }
+        };
+    }
+
 //    template <typename E, typename Iter = const typename internal::utf_traits<E>::codeunit_type*>
     template <typename Iter, typename E = typename internal::native_encoding<typename std::iterator_traits<Iter>::value_type>::type>
     struct stringview {
@@ -382,10 +533,9 @@ namespace utf {
 
         template <typename EDest, typename OutIt>
         OutIt to(OutIt dest) const {
-            for (codepoint_iterator<Iter> it = begin(); it != end(); ++it) {
-                dest = internal::utf_traits<EDest>::encode(*it, dest);
-            }
-            return dest;
+            internal::encoder<EDest, OutIt> enc = { dest };
+            internal::for_each_block(begin(), end(), enc);
+            return enc.dest;
         }
 
     private:
@@ -393,6 +543,384 @@ namespace utf {
         const Iter last;
     };
 
+    // Call f on each code point of sv, in order. Returns f.
+    // Prefer this over a loop over codepoint_iterator: code points are
+    // decoded a block at a time, and f is applied to a local buffer.
+    template <typename Iter, typename E, typename F>
+    F for_each_codepoint(const stringview<Iter, E>& sv, F f) {
+        internal::for_each_block(sv.begin(), sv.end(), f);
+        return f;
+    }
+
+    // Encode f(c) as EDest to dest, for each code point c of sv. Same as
+    // sv.to<EDest>(dest), but with a per code point mapping applied on the
+    // way. Returns the end of the output.
+    template <typename EDest, typename Iter, typename E, typename OutIt, typename F>
+    OutIt transform(const stringview<Iter, E>& sv, OutIt dest, F f) {
+        internal::transform_encoder<EDest, OutIt, F> enc = { dest, f };
+        internal::for_each_block(sv.begin(), sv.end(), enc);
+        return enc.dest;
+    }
+
+    // The longest prefix of sv which is at most max_bytes long and ends on a
+    // code point boundary. Only looks at the code units around the cut: at
+    // most 3 for UTF-8, 1 for UTF-16. sv is assumed to be valid.
+    template <typename Iter, typename E>
+    stringview<Iter, E> truncate_bytes(const stringview<Iter, E>& sv, size_t max_bytes) {
+        typedef internal::utf_traits<E> traits_t;
+        const Iter first = sv.begin().base();
+        size_t units = max_bytes / sizeof(typename traits_t::codeunit_type);
+        if (units >= sv.codeunits()) { return sv; }
+        Iter cut = first + units;
+        while (cut != first && traits_t::is_continuation(static_cast<typename traits_t::codeunit_type>(*cut))) {
+            --cut;
+        }
+        return stringview<Iter, E>(first, cut);
+    }
+
+    namespace internal {
+        // Find the first occurrence of the n code units at needle in
+        // [first, last), or last. A valid needle starts with a lead unit,
+        // which never matches a continuation unit, so in valid text matches
+        // always start and end on code point boundaries.
+        template <typename E, typename Iter>
+        struct searcher {
+            typedef typename utf_traits<E>::codeunit_type unit_type;
+
+            static Iter find(Iter first, Iter last, const unit_type* needle, size_t n) {
+                for (; first != last; ++first) {
+                    Iter it = first;
+                    size_t i = 0;
+                    for (; i < n && it != last && static_cast<unit_type>(*it) == needle[i]; ++i, ++it) {}
+                    if (i == n) { return first; }
+                    if (it == last) { break; }
+                }
+                return last;
+            }
+        };
+
+        // contiguous code units: candidates are found by their first unit
+        // (with memchr for UTF-8), then filtered on the last unit before
+        // comparing the rest
+        template <typename E, typename T>
+        struct searcher<E, T*> {
+            typedef typename utf_traits<E>::codeunit_type unit_type;
+
+            static T* find(T* first, T* last, const unit_type* needle, size_t n) {
+                if (n == 0) { return first; }
+                for (; last - first >= static_cast<ptrdiff_t>(n); ++first) {
+                    first = next_unit(first, last - n + 1, needle[0]);
+                    if (first == last - n + 1) { break; }
+                    if (static_cast<unit_type>(first[n - 1]) == needle[n - 1] && matches(first + 1, needle + 1, n - 1)) { return first; }
+                }
+                return last;
+            }
+
+        private:
+            static T* next_unit(T* first, T* last, unit_type u) {
+                if (sizeof(T) == 1) {
+                    const void* p = std::memchr(first, static_cast<unsigned char>(u), last - first);
+                    return p ? first + (static_cast<const char*>(p) - reinterpret_cast<const char*>(first)) : last;
+                }
+                while (first != last && static_cast<unit_type>(*first) != u) { ++first; }
+                return first;
+            }
+            static bool matches(const T* p, const unit_type* needle, size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (static_cast<unit_type>(p[i]) != needle[i]) { return false; }
+                }
+                return true;
+            }
+        };
+
+        // does [first, last) start with the code points of needle?
+        template <typename It1, typename It2>
+        bool starts_with(codepoint_iterator<It1> first, codepoint_iterator<It1> last, codepoint_iterator<It2> needle, codepoint_iterator<It2> needle_end) {
+            for (; needle != needle_end; ++needle, ++first) {
+                if (first == last || *first != *needle) { return false; }
+            }
+            return true;
+        }
+
+        // needles up to this many code units are encoded on the stack in
+        // one go; longer ones only have their start encoded
+        static const size_t search_prefix_units = 64;
+    }
+
+    // The first occurrence of the code point c in sv, or sv.end(). The code
+    // point is encoded once, and the search runs on the code units. A
+    // surrogate or a value above 0x10ffff is never found.
+    template <typename Iter, typename E>
+    codepoint_iterator<Iter> find(const stringview<Iter, E>& sv, codepoint_type c) {
+        typedef internal::utf_traits<E> traits_t;
+        if (!internal::validate_codepoint(c)) { return sv.end(); }
+        typename traits_t::codeunit_type buf[4];
+        size_t n = traits_t::encode(c, buf) - buf;
+        return codepoint_iterator<Iter>(internal::searcher<E, Iter>::find(sv.begin().base(), sv.end().base(), buf, n));
+    }
+
+    // The first occurrence of needle in sv, or sv.end(). needle may be in
+    // any encoding: it is encoded into sv's encoding once, and the search
+    // runs on the code units. An empty needle is found at the start, and a
+    // needle holding a surrogate or a value above 0x10ffff is never found.
+    template <typename Iter, typename E, typename Iter2, typename E2>
+    codepoint_iterator<Iter> find(const stringview<Iter, E>& sv, const stringview<Iter2, E2>& needle) {
+        typedef internal::utf_traits<E> traits_t;
+        typedef typename traits_t::codeunit_type unit_type;
+        unit_type buf[internal::search_prefix_units + 4];
+        size_t n = 0;
+        codepoint_iterator<Iter2> rest = needle.begin();
+        const codepoint_iterator<Iter2> needle_end = needle.end();
+        for (; rest != needle_end && n < internal::search_prefix_units; ++rest) {
+            const codepoint_type c = *rest;
+            if (!internal::validate_codepoint(c)) { return sv.end(); }
+            n = traits_t::encode(c, buf + n) - buf;
+        }
+        // the rest is compared by code point in starts_with
+        for (codepoint_iterator<Iter2> it = rest; it != needle_end; ++it) {
+            if (!internal::validate_codepoint(*it)) { return sv.end(); }
+        }
+
+        const Iter last = sv.end().base();
+        Iter pos = sv.begin().base();
+        for (;;) {
+            pos = internal::searcher<E, Iter>::find(pos, last, buf, n);
+            if (pos == last) { return sv.end(); }
+            // a long needle: check the part which wasn't encoded
+            if (rest == needle_end || internal::starts_with(codepoint_iterator<Iter>(pos + n), sv.end(), rest, needle_end)) {
+                return codepoint_iterator<Iter>(pos);
+            }
+            ++pos;
+        }
+    }
+
+    namespace internal {
+        // finds a single encoded code point, or nothing if len is 0
+        template <typename E, typename Iter>
+        struct codepoint_finder {
+            typename utf_traits<E>::codeunit_type units[4];
+            size_t len;
+
+            Iter find(Iter first, Iter last, size_t& match_len) const {
+                match_len = len;
+                if (len == 0) { return last; }
+                return searcher<E, Iter>::find(first, last, units, len);
+            }
+        };
+
+        // Find the first code point in [first, last) for which
+        // set.contains(c) is true, setting len to its length in code units.
+        // A unit below 0x80 is a whole ASCII code point in every encoding,
+        // so those are looked up without decoding.
+        template <typename E, typename Iter>
+        struct set_scan {
+            typedef utf_traits<E> traits_t;
+            typedef typename traits_t::codeunit_type unit_type;
+
+            template <typename Set>
+            static Iter find(Iter first, Iter last, const Set& set, size_t& len) {
+                while (first != last) {
+                    uint32_t u = static_cast<uint32_t>(static_cast<unit_type>(*first));
+                    if (u < 0x80) {
+                        if (set.contains(u)) {
+                            len = 1;
+                            return first;
+                        }
+                        ++first;
+                        continue;
+                    }
+                    len = traits_t::read_length(static_cast<unit_type>(*first));
+                    if (set.contains(traits_t::decode(first))) { return first; }
+                    first += len;
+                }
+                return last;
+            }
+        };
+
+        // UTF-8 in memory: if the set has no ASCII members, runs of ASCII
+        // are skipped 8 bytes at a time
+        template <typename T>
+        struct set_scan<utf8, T*> {
+            typedef utf_traits<utf8> traits_t;
+
+            template <typename Set>
+            static T* find(T* first, T* last, const Set& set, size_t& len) {
+                const bool no_ascii = !set.has_ascii();
+                while (first != last) {
+                    if (no_ascii) {
+                        while (last - first >= 8 && ascii8(first)) { first += 8; }
+                        if (first == last) { break; }
+                    }
+                    uint32_t u = static_cast<uint8_t>(*first);
+                    if (u < 0x80) {
+                        if (set.contains(u)) {
+                            len = 1;
+                            return first;
+                        }
+                        ++first;
+                        continue;
+                    }
+                    len = traits_t::read_length(*first);
+                    if (set.contains(traits_t::decode(first))) { return first; }
+                    first += len;
+                }
+                return last;
+            }
+        };
+
+        // finds any code point for which set.contains(c) is true
+        template <typename E, typename Iter, typename Set>
+        struct set_finder {
+            Set set;
+
+            Iter find(Iter first, Iter last, size_t& match_len) const {
+                return set_scan<E, Iter>::find(first, last, set, match_len);
+            }
+        };
+
+        // the code points of a stringview as a set. ASCII code points are
+        // looked up in a bitmap, the others in a sorted array. Lists with
+        // more than max_sorted non-ASCII code points are searched linearly
+        // instead, since we can't allocate.
+        template <typename Iter, typename E>
+        struct delimiter_list {
+            static const size_t max_sorted = 32;
+
+            stringview<Iter, E> list;
+            uint32_t ascii[4];
+            codepoint_type sorted[max_sorted];
+            size_t count;
+            bool overflow;
+
+            explicit delimiter_list(const stringview<Iter, E>& list) : list(list), count(), overflow(false) {
+                ascii[0] = ascii[1] = ascii[2] = ascii[3] = 0;
+                for (codepoint_iterator<Iter> it = list.begin(); it != list.end(); ++it) {
+                    codepoint_type c = *it;
+                    if (c < 0x80) { ascii[c >> 5] |= 1u << (c & 31); }
+                    else if (count == max_sorted) { overflow = true; }
+                    else {
+                        // insertion sort
+                        size_t i = count++;
+                        for (; i > 0 && sorted[i - 1] > c; --i) { sorted[i] = sorted[i - 1]; }
+                        sorted[i] = c;
+                    }
+                }
+            }
+
+            bool has_ascii() const { return (ascii[0] | ascii[1] | ascii[2] | ascii[3]) != 0; }
+
+            bool contains(codepoint_type c) const {
+                if (c < 0x80) { return (ascii[c >> 5] >> (c & 31)) & 1; }
+                if (overflow) {
+                    for (codepoint_iterator<Iter> it = list.begin(); it != list.end(); ++it) {
+                        if (*it == c) { return true; }
+                    }
+                    return false;
+                }
+                size_t lo = 0;
+                size_t hi = count;
+                while (lo < hi) {
+                    size_t mid = lo + (hi - lo) / 2;
+                    if (sorted[mid] < c) { lo = mid + 1; }
+                    else { hi = mid; }
+                }
+                return lo < count && sorted[lo] == c;
+            }
+        };
+    }
+
+    // Iterates over the pieces of a string between delimiters, as found by
+    // Finder. Each piece is returned as a stringview.
+    template <typename Iter, typename E, typename Finder>
+    class split_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef stringview<Iter, E> value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        split_iterator() : pos(), piece_end(), last(), finder(), delim_len(), done(true) {}
+        // the past-the-end iterator
+        explicit split_iterator(const Finder& finder) : pos(), piece_end(), last(), finder(finder), delim_len(), done(true) {}
+        split_iterator(Iter first, Iter last, const Finder& finder)
+        : pos(first), piece_end(), last(last), finder(finder), delim_len(), done(false) {
+            piece_end = this->finder.find(pos, last, delim_len);
+        }
+
+        reference operator*() const { return value_type(pos, piece_end); }
+        split_iterator& operator++() {
+            if (piece_end == last) {
+                done = true;
+            }
+            else {
+                pos = piece_end + delim_len;
+                piece_end = finder.find(pos, last, delim_len);
+            }
+            return *this;
+        }
+        split_iterator operator++(int) {
+            split_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator == (const split_iterator& lhs, const split_iterator& rhs) {
+            return lhs.done == rhs.done && (lhs.done || lhs.pos == rhs.pos);
+        }
+        friend bool operator != (const split_iterator& lhs, const split_iterator& rhs) { return !(lhs == rhs); }
+
+    private:
+        Iter pos;
+        Iter piece_end;
+        Iter last;
+        Finder finder;
+        size_t delim_len;
+        bool done;
+    };
+
+    // The pieces of a string between delimiters, computed lazily as the
+    // range is iterated
+    template <typename Iter, typename E, typename Finder>
+    class split_range {
+    public:
+        typedef split_iterator<Iter, E, Finder> iterator;
+        typedef iterator const_iterator;
+
+        split_range(Iter first, Iter last, const Finder& finder) : first(first), last(last), finder(finder) {}
+
+        iterator begin() const { return iterator(first, last, finder); }
+        iterator end() const { return iterator(finder); }
+
+    private:
+        Iter first;
+        Iter last;
+        Finder finder;
+    };
+
+    // The pieces of sv separated by the code point delim. Consecutive
+    // delimiters give empty pieces, and an empty string gives one empty
+    // piece. The delimiter is encoded once, and found by searching the
+    // code units.
+    template <typename Iter, typename E>
+    split_range<Iter, E, internal::codepoint_finder<E, Iter> > split(const stringview<Iter, E>& sv, codepoint_type delim) {
+        internal::codepoint_finder<E, Iter> finder;
+        // an invalid delimiter is never found
+        if (!internal::validate_codepoint(delim)) {
+            finder.len = 0;
+            return split_range<Iter, E, internal::codepoint_finder<E, Iter> >(sv.begin().base(), sv.end().base(), finder);
+        }
+        finder.len = internal::utf_traits<E>::encode(delim, finder.units) - finder.units;
+        return split_range<Iter, E, internal::codepoint_finder<E, Iter> >(sv.begin().base(), sv.end().base(), finder);
+    }
+
+    // The pieces of sv separated by any of the code points in delims
+    template <typename Iter, typename E, typename Iter2, typename E2>
+    split_range<Iter, E, internal::set_finder<E, Iter, internal::delimiter_list<Iter2, E2> > > split_any(const stringview<Iter, E>& sv, const stringview<Iter2, E2>& delims) {
+        internal::set_finder<E, Iter, internal::delimiter_list<Iter2, E2> > finder = { internal::delimiter_list<Iter2, E2>(delims) };
+        return split_range<Iter, E, internal::set_finder<E, Iter, internal::delimiter_list<Iter2, E2> > >(sv.begin().base(), sv.end().base(), finder);
+    }
+
     // convenience stuff
     template <typename T, size_t N>
     stringview<const T*> make_stringview(T (&arr)[N]) {
@@ -404,6 +932,389 @@ namespace utf {
     make_stringview(Iter first, Iter last) {
         return stringview<Iter>(first, last);
     }
+
+    // runtime identifiers for the encodings
+    enum encoding { utf8_encoding, utf16_encoding, utf32_encoding };
+
+    namespace internal {
+        template <typename E>
+        struct encoding_id;
+
+        template <>
+        struct encoding_id<utf8> {
+            static const encoding value = utf8_encoding;
+        };
+        template <>
+        struct encoding_id<utf16> {
+            static const encoding value = utf16_encoding;
+        };
+        template <>
+        struct encoding_id<utf32> {
+            static const encoding value = utf32_encoding;
+        };
+
+        // operations dispatched by any_stringview::visit
+        struct validate_op {
+            bool res;
+            template <typename SV>
+            void operator()(const SV& sv) { res = sv.validate(); }
+        };
+        struct codepoints_op {
+            size_t res;
+            template <typename SV>
+            void operator()(const SV& sv) { res = sv.codepoints(); }
+        };
+        template <typename EDest>
+        struct codeunits_op {
+            size_t res;
+            template <typename SV>
+            void operator()(const SV& sv) { res = sv.template codeunits<EDest>(); }
+        };
+        template <typename EDest, typename OutIt>
+        struct to_op {
+            OutIt dest;
+            template <typename SV>
+            void operator()(const SV& sv) { dest = sv.template to<EDest>(dest); }
+        };
+        template <typename F>
+        struct for_each_op {
+            F f;
+            template <typename SV>
+            void operator()(const SV& sv) { f = for_each_codepoint(sv, f); }
+        };
+        template <typename EDest, typename OutIt, typename F>
+        struct transform_op {
+            OutIt dest;
+            F f;
+            template <typename SV>
+            void operator()(const SV& sv) { dest = transform<EDest>(sv, dest, f); }
+        };
+    }
+
+    // A stringview whose encoding is only known at runtime. It holds a
+    // pointer to contiguous code units (which must be suitably aligned for
+    // the encoding's code unit type), a length and an encoding, and each
+    // operation switches on the encoding once, then runs the same code as
+    // the corresponding stringview<const T*>.
+    class any_stringview {
+    public:
+        any_stringview(const void* data, size_t codeunits, encoding enc)
+        : ptr(data), len(codeunits), enc(enc) {}
+
+        template <typename T, typename E>
+        any_stringview(const stringview<const T*, E>& sv)
+        : ptr(sv.begin().base()), len(sv.codeunits()), enc(internal::encoding_id<E>::value) {}
+
+        encoding get_encoding() const { return enc; }
+        const void* data() const { return ptr; }
+
+        // Call f with the stringview<const T*> matching the encoding. Returns f.
+        template <typename F>
+        F visit(F f) const {
+            switch (enc) {
+                case utf8_encoding:
+                {
+                    const char* first = static_cast<const char*>(ptr);
+                    f(stringview<const char*>(first, first + len));
+                    break;
+                }
+                case utf16_encoding:
+                {
+                    const char16_t* first = static_cast<const char16_t*>(ptr);
+                    f(stringview<const char16_t*>(first, first + len));
+                    break;
+                }
+                case utf32_encoding:
+                {
+                    const char32_t* first = static_cast<const char32_t*>(ptr);
+                    f(stringview<const char32_t*>(first, first + len));
+                    break;
+                }
+            }
+            return f;
+        }
+
+        bool validate() const {
+            internal::validate_op op = { false };
+            return visit(op).res;
+        }
+
+        size_t codepoints() const {
+            internal::codepoints_op op = { 0 };
+            return visit(op).res;
+        }
+
+        size_t bytes() const {
+            return codeunits() * unit_size(enc);
+        }
+
+        template <typename EDest>
+        size_t bytes() const {
+            return codeunits<EDest>() * sizeof(typename internal::utf_traits<EDest>::codeunit_type);
+        }
+
+        // length if encoded as dest
+        size_t bytes(encoding dest) const {
+            return codeunits(dest) * unit_size(dest);
+        }
+
+        size_t codeunits() const { return len; }
+
+        template <typename EDest>
+        size_t codeunits() const {
+            internal::codeunits_op<EDest> op = { 0 };
+            return visit(op).res;
+        }
+
+        size_t codeunits(encoding dest) const {
+            switch (dest) {
+                case utf8_encoding: return codeunits<utf8>();
+                case utf16_encoding: return codeunits<utf16>();
+                case utf32_encoding: return codeunits<utf32>();
+            }
+            return 0;
+        }
+
+        template <typename EDest, typename OutIt>
+        OutIt to(OutIt dest) const {
+            internal::to_op<EDest, OutIt> op = { dest };
+            return visit(op).dest;
+        }
+
+        // Encode as dest into the buffer at out, which must be large enough
+        // to hold bytes(dest) bytes, and suitably aligned. Returns the number
+        // of code units written.
+        size_t to(encoding dest, void* out) const {
+            switch (dest) {
+                case utf8_encoding: return to<utf8>(static_cast<char*>(out)) - static_cast<char*>(out);
+                case utf16_encoding: return to<utf16>(static_cast<char16_t*>(out)) - static_cast<char16_t*>(out);
+                case utf32_encoding: return to<utf32>(static_cast<char32_t*>(out)) - static_cast<char32_t*>(out);
+            }
+            return 0;
+        }
+
+        static size_t unit_size(encoding e) {
+            switch (e) {
+                case utf8_encoding: return 1;
+                case utf16_encoding: return 2;
+                case utf32_encoding: return 4;
+            }
+            return 0;
+        }
+
+    private:
+        const void* ptr;
+        size_t len;
+        encoding enc;
+    };
+
+    template <typename F>
+    F for_each_codepoint(const any_stringview& sv, F f) {
+        internal::for_each_op<F> op = { f };
+        return sv.visit(op).f;
+    }
+
+    template <typename EDest, typename OutIt, typename F>
+    OutIt transform(const any_stringview& sv, OutIt dest, F f) {
+        internal::transform_op<EDest, OutIt, F> op = { dest, f };
+        return sv.visit(op).dest;
+    }
+
+    namespace internal {
+        template <typename T>
+        int three_way(T lhs, T rhs) {
+            return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+        }
+
+        // Code point order comparisons. The general case decodes both sides
+        // a block at a time. When both sides are pointers into the same
+        // encoding, code units are compared directly.
+        template <typename E1, typename It1, typename E2, typename It2>
+        struct comparer {
+            static int compare(It1 first1, It1 last1, It2 first2, It2 last2) {
+                codepoint_type buf1[block_size];
+                codepoint_type buf2[block_size];
+                codepoint_iterator<It1> pos1(first1);
+                codepoint_iterator<It2> pos2(first2);
+                const codepoint_iterator<It1> end1(last1);
+                const codepoint_iterator<It2> end2(last2);
+                size_t i1 = 0, n1 = 0, i2 = 0, n2 = 0;
+                for (;;) {
+                    if (i1 == n1) {
+                        i1 = 0;
+                        pos1 = decode_block(pos1, end1, buf1, n1);
+                    }
+                    if (i2 == n2) {
+                        i2 = 0;
+                        pos2 = decode_block(pos2, end2, buf2, n2);
+                    }
+                    if (n1 == 0 || n2 == 0) { return three_way(n1, n2); }
+
+                    size_t n = n1 - i1 < n2 - i2 ? n1 - i1 : n2 - i2;
+                    for (size_t i = 0; i < n; ++i) {
+                        if (buf1[i1 + i] != buf2[i2 + i]) { return three_way(buf1[i1 + i], buf2[i2 + i]); }
+                    }
+                    i1 += n;
+                    i2 += n;
+                }
+            }
+            static bool equal(It1 first1, It1 last1, It2 first2, It2 last2) {
+                return compare(first1, last1, first2, last2) == 0;
+            }
+        };
+
+        // lexicographic comparison of unsigned code unit values
+        template <typename U, typename T1, typename T2>
+        int compare_units(T1* first1, T1* last1, T2* first2, T2* last2) {
+            for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+                U c1 = static_cast<U>(*first1);
+                U c2 = static_cast<U>(*first2);
+                if (c1 != c2) { return three_way(c1, c2); }
+            }
+            return three_way(first1 != last1, first2 != last2);
+        }
+
+        template <typename T1, typename T2>
+        bool equal_units(T1* first1, T1* last1, T2* first2, T2* last2) {
+            return last1 - first1 == last2 - first2
+                && (first1 == last1 || std::memcmp(first1, first2, (last1 - first1) * sizeof(T1)) == 0);
+        }
+
+        // UTF-8 byte order is code point order
+        template <typename T1, typename T2>
+        struct comparer<utf8, T1*, utf8, T2*> {
+            static int compare(T1* first1, T1* last1, T2* first2, T2* last2) {
+                size_t len1 = last1 - first1;
+                size_t len2 = last2 - first2;
+                size_t len = len1 < len2 ? len1 : len2;
+                int res = len != 0 ? std::memcmp(first1, first2, len) : 0;
+                return res != 0 ? three_way(res, 0) : three_way(len1, len2);
+            }
+            static bool equal(T1* first1, T1* last1, T2* first2, T2* last2) { return equal_units(first1, last1, first2, last2); }
+        };
+
+        // UTF-16 code unit order differs from code point order once
+        // surrogates are involved: 0xe000-0xffff must sort below the
+        // surrogates (which encode code points above 0xffff), so both are
+        // shifted before comparing
+        inline uint16_t utf16_fixup(uint16_t c) {
+            if (c >= 0xe000) { return c - 0x800; }
+            if (c >= 0xd800) { return c + 0x2000; }
+            return c;
+        }
+
+        template <typename T1, typename T2>
+        struct comparer<utf16, T1*, utf16, T2*> {
+            static int compare(T1* first1, T1* last1, T2* first2, T2* last2) {
+                for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+                    uint16_t c1 = static_cast<uint16_t>(*first1);
+                    uint16_t c2 = static_cast<uint16_t>(*first2);
+                    if (c1 != c2) { return three_way(utf16_fixup(c1), utf16_fixup(c2)); }
+                }
+                return three_way(first1 != last1, first2 != last2);
+            }
+            static bool equal(T1* first1, T1* last1, T2* first2, T2* last2) { return equal_units(first1, last1, first2, last2); }
+        };
+
+        template <typename T1, typename T2>
+        struct comparer<utf32, T1*, utf32, T2*> {
+            static int compare(T1* first1, T1* last1, T2* first2, T2* last2) { return compare_units<uint32_t>(first1, last1, first2, last2); }
+            static bool equal(T1* first1, T1* last1, T2* first2, T2* last2) { return equal_units(first1, last1, first2, last2); }
+        };
+    }
+
+    // Compare lhs and rhs in code point order, whatever their encodings.
+    // Returns a negative value if lhs sorts first, 0 if they are equal, and
+    // a positive value if rhs sorts first.
+    template <typename It1, typename E1, typename It2, typename E2>
+    int compare(const stringview<It1, E1>& lhs, const stringview<It2, E2>& rhs) {
+        return internal::comparer<E1, It1, E2, It2>::compare(lhs.begin().base(), lhs.end().base(), rhs.begin().base(), rhs.end().base());
+    }
+
+    // true if lhs and rhs hold the same sequence of code points
+    template <typename It1, typename E1, typename It2, typename E2>
+    bool equal(const stringview<It1, E1>& lhs, const stringview<It2, E2>& rhs) {
+        return internal::comparer<E1, It1, E2, It2>::equal(lhs.begin().base(), lhs.end().base(), rhs.begin().base(), rhs.end().base());
+    }
+
+    namespace internal {
+        // FNV-1a over 32-bit code point values
+        struct hash_state {
+            uint64_t h;
+            void operator()(codepoint_type c) {
+                h = (h ^ c) * 0x100000001b3ULL;
+            }
+            size_t finish() const {
+                // final avalanche (from MurmurHash3), so all bits depend on
+                // the whole input
+                uint64_t k = h;
+                k ^= k >> 33;
+                k *= 0xff51afd7ed558ccdULL;
+                k ^= k >> 33;
+                k *= 0xc4ceb9fe1a85ec53ULL;
+                k ^= k >> 33;
+                return static_cast<size_t>(k);
+            }
+        };
+        static const uint64_t hash_seed = 0xcbf29ce484222325ULL;
+    }
+
+    // Hash of the code point sequence of sv. The result only depends on the
+    // code points, not on the encoding, so the same text hashes to the same
+    // value whether it is stored as UTF-8, UTF-16 or UTF-32.
+    template <typename Iter, typename E>
+    size_t hash(const stringview<Iter, E>& sv) {
+        internal::hash_state st = { internal::hash_seed };
+        return for_each_codepoint(sv, st).finish();
+    }
+
+    inline size_t hash(const any_stringview& sv) {
+        internal::hash_state st = { internal::hash_seed };
+        return for_each_codepoint(sv, st).finish();
+    }
+
+    // Hasher and equality predicate which treat strings as code point
+    // sequences. Both accept stringviews, and any contiguous container of
+    // code units with data() and size() (std::string, std::u16string,
+    // std::vector<char32_t>, ...), with the encoding deduced from the code
+    // unit size. Both are transparent, so with C++20 an
+    // unordered_map<std::string, V, codepoint_hash, codepoint_equal> can be
+    // probed with UTF-16 or UTF-32 keys without converting them first.
+    struct codepoint_hash {
+        typedef void is_transparent;
+
+        template <typename Iter, typename E>
+        size_t operator()(const stringview<Iter, E>& sv) const { return hash(sv); }
+
+        template <typename S>
+        size_t operator()(const S& s) const {
+            return hash(make_stringview(s.data(), s.data() + s.size()));
+        }
+    };
+
+    struct codepoint_equal {
+        typedef void is_transparent;
+
+        template <typename It1, typename E1, typename It2, typename E2>
+        bool operator()(const stringview<It1, E1>& lhs, const stringview<It2, E2>& rhs) const {
+            return equal(lhs, rhs);
+        }
+
+        template <typename Iter, typename E, typename S>
+        bool operator()(const stringview<Iter, E>& lhs, const S& rhs) const {
+            return (*this)(lhs, make_stringview(rhs.data(), rhs.data() + rhs.size()));
+        }
+
+        template <typename S, typename Iter, typename E>
+        bool operator()(const S& lhs, const stringview<Iter, E>& rhs) const {
+            return (*this)(make_stringview(lhs.data(), lhs.data() + lhs.size()), rhs);
+        }
+
+        template <typename S1, typename S2>
+        bool operator()(const S1& lhs, const S2& rhs) const {
+            return (*this)(make_stringview(lhs.data(), lhs.data() + lhs.size()), make_stringview(rhs.data(), rhs.data() + rhs.size()));
+        }
+    };
 }
 
 #endif
\ No newline at end of file
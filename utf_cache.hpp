@@ -0,0 +1,251 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// A cache of transcoded strings, for programs which convert the same
+// strings over and over. Requires C++11.
+//
+// Unlike utf.hpp, this allocates and is meant to be shared between threads.
+
+#ifndef NP_UTF_CACHE_HPP
+#define NP_UTF_CACHE_HPP
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include "utf.hpp"
+
+namespace utf {
+    namespace internal {
+        // One cached conversion. Immutable once published, except for the
+        // CLOCK reference bit
+        struct cache_entry {
+            std::vector<char> source; // source code units, as bytes
+            encoding from;
+            encoding to;
+            size_t hash;
+            void* units;
+            size_t count;
+            mutable std::atomic<bool> referenced;
+
+            cache_entry() : from(), to(), hash(), units(), count(), referenced(false) {}
+            ~cache_entry() { ::operator delete(units); }
+
+            // what the entry counts against the cache's byte budget
+            size_t cost() const { return sizeof(cache_entry) + source.size() + count * any_stringview::unit_size(to); }
+
+        private:
+            cache_entry(const cache_entry&);
+            cache_entry& operator = (const cache_entry&);
+        };
+
+        // map key, pointing either into an entry or at the string being looked up
+        struct cache_key {
+            const char* data;
+            size_t size;
+            encoding from;
+            encoding to;
+            size_t hash;
+        };
+
+        struct cache_key_hash {
+            size_t operator()(const cache_key& k) const { return k.hash; }
+        };
+        struct cache_key_equal {
+            bool operator()(const cache_key& lhs, const cache_key& rhs) const {
+                return lhs.hash == rhs.hash && lhs.size == rhs.size && lhs.from == rhs.from && lhs.to == rhs.to
+                    && (lhs.size == 0 || std::memcmp(lhs.data, rhs.data, lhs.size) == 0);
+            }
+        };
+
+        inline cache_key make_cache_key(const any_stringview& sv, encoding to) {
+            cache_key k;
+            k.data = static_cast<const char*>(sv.data());
+            k.size = sv.bytes();
+            k.from = sv.get_encoding();
+            k.to = to;
+            hash_state st = { hash_seed };
+            st(k.from);
+            st(k.to);
+            for (size_t i = 0; i < k.size; ++i) {
+                st(static_cast<uint8_t>(k.data[i]));
+            }
+            k.hash = st.finish();
+            return k;
+        }
+    }
+
+    // A converted string returned by transcode_cache. Holding on to it keeps
+    // the data alive, even if the cache evicts the entry in the meantime.
+    template <typename EDest>
+    class cached_text {
+    public:
+        typedef typename internal::utf_traits<EDest>::codeunit_type value_type;
+
+        cached_text() {}
+        explicit cached_text(std::shared_ptr<const internal::cache_entry> entry) : entry(entry) {}
+
+        const value_type* data() const { return entry ? static_cast<const value_type*>(entry->units) : 0; }
+        size_t codeunits() const { return entry ? entry->count : 0; }
+        stringview<const value_type*, EDest> view() const { return stringview<const value_type*, EDest>(data(), data() + codeunits()); }
+
+    private:
+        std::shared_ptr<const internal::cache_entry> entry;
+    };
+
+    struct cache_stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t entries;
+        size_t bytes;
+    };
+
+    // A thread-safe cache of transcoded strings, keyed by the source code
+    // units and the target encoding.
+    //
+    // The cache is split into shards, each with its own lock, which is only
+    // held for the hash table lookup; conversions happen outside it. Each
+    // shard gets an equal part of the byte budget and evicts with the CLOCK
+    // algorithm: a hit just sets the entry's reference bit, and eviction
+    // skips (and clears) entries whose bit is set.
+    class transcode_cache {
+        struct shard {
+            std::mutex lock;
+            std::unordered_map<internal::cache_key, std::shared_ptr<const internal::cache_entry>, internal::cache_key_hash, internal::cache_key_equal> map;
+            std::vector<std::shared_ptr<const internal::cache_entry> > ring;
+            size_t hand;
+            size_t bytes;
+            std::atomic<uint64_t> hits;
+            std::atomic<uint64_t> misses;
+            std::atomic<uint64_t> evictions;
+            // keep shards on separate cache lines
+            char padding[64];
+
+            shard() : hand(0), bytes(0), hits(0), misses(0), evictions(0) {}
+        };
+
+    public:
+        explicit transcode_cache(size_t byte_budget, size_t shard_count = 16)
+        : shards(new shard[shard_count ? shard_count : 1]), shard_count(shard_count ? shard_count : 1)
+        , shard_budget(byte_budget / (shard_count ? shard_count : 1)) {}
+
+        // sv converted to EDest, from the cache if possible
+        template <typename EDest>
+        cached_text<EDest> get(const any_stringview& sv) {
+            internal::cache_key k = internal::make_cache_key(sv, internal::encoding_id<EDest>::value);
+            shard& s = shards[k.hash % shard_count];
+            {
+                std::lock_guard<std::mutex> guard(s.lock);
+                auto it = s.map.find(k);
+                if (it != s.map.end()) {
+                    s.hits.fetch_add(1, std::memory_order_relaxed);
+                    it->second->referenced.store(true, std::memory_order_relaxed);
+                    return cached_text<EDest>(it->second);
+                }
+            }
+            s.misses.fetch_add(1, std::memory_order_relaxed);
+            std::shared_ptr<internal::cache_entry> e = convert<EDest>(sv, k);
+            return cached_text<EDest>(insert(s, e));
+        }
+
+        template <typename EDest, typename T, typename E>
+        cached_text<EDest> get(const stringview<const T*, E>& sv) {
+            return get<EDest>(any_stringview(sv));
+        }
+
+        cache_stats stats() const {
+            cache_stats res = {};
+            for (size_t i = 0; i < shard_count; ++i) {
+                shard& s = shards[i];
+                res.hits += s.hits.load(std::memory_order_relaxed);
+                res.misses += s.misses.load(std::memory_order_relaxed);
+                res.evictions += s.evictions.load(std::memory_order_relaxed);
+                std::lock_guard<std::mutex> guard(s.lock);
+                res.entries += s.ring.size();
+                res.bytes += s.bytes;
+            }
+            return res;
+        }
+
+        // drop all entries. Outstanding cached_text objects stay valid
+        void clear() {
+            for (size_t i = 0; i < shard_count; ++i) {
+                shard& s = shards[i];
+                std::lock_guard<std::mutex> guard(s.lock);
+                s.map.clear();
+                s.ring.clear();
+                s.hand = 0;
+                s.bytes = 0;
+            }
+        }
+
+    private:
+        transcode_cache(const transcode_cache&);
+        transcode_cache& operator = (const transcode_cache&);
+
+        template <typename EDest>
+        static std::shared_ptr<internal::cache_entry> convert(const any_stringview& sv, const internal::cache_key& k) {
+            typedef typename internal::utf_traits<EDest>::codeunit_type unit_type;
+            std::shared_ptr<internal::cache_entry> e = std::make_shared<internal::cache_entry>();
+            e->source.assign(k.data, k.data + k.size);
+            e->from = k.from;
+            e->to = k.to;
+            e->hash = k.hash;
+            e->count = sv.codeunits<EDest>();
+            e->units = ::operator new(e->count * sizeof(unit_type));
+            sv.to<EDest>(static_cast<unit_type*>(e->units));
+            return e;
+        }
+
+        std::shared_ptr<const internal::cache_entry> insert(shard& s, const std::shared_ptr<internal::cache_entry>& e) {
+            internal::cache_key k = { e->source.data(), e->source.size(), e->from, e->to, e->hash };
+            size_t cost = e->cost();
+            // too big to ever fit; hand it out uncached
+            if (cost > shard_budget) { return e; }
+
+            std::lock_guard<std::mutex> guard(s.lock);
+            auto it = s.map.find(k);
+            // another thread converted the same string in the meantime
+            if (it != s.map.end()) { return it->second; }
+
+            while (s.bytes + cost > shard_budget && !s.ring.empty()) {
+                evict_one(s);
+            }
+            s.map.insert(std::make_pair(k, e));
+            s.ring.push_back(e);
+            s.bytes += cost;
+            return e;
+        }
+
+        static void evict_one(shard& s) {
+            for (;;) {
+                if (s.hand >= s.ring.size()) { s.hand = 0; }
+                const internal::cache_entry& victim = *s.ring[s.hand];
+                if (victim.referenced.exchange(false, std::memory_order_relaxed)) {
+                    ++s.hand;
+                    continue;
+                }
+                internal::cache_key k = { victim.source.data(), victim.source.size(), victim.from, victim.to, victim.hash };
+                s.bytes -= victim.cost();
+                s.map.erase(k);
+                s.ring[s.hand] = s.ring.back();
+                s.ring.pop_back();
+                s.evictions.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        std::unique_ptr<shard[]> shards;
+        size_t shard_count;
+        size_t shard_budget;
+    };
+}
+
+#endif
@@ -0,0 +1,352 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Coroutine generators on top of utf.hpp. Requires C++20.
+//
+// Values are produced a block at a time: the coroutine is suspended and
+// resumed once per block rather than once per code point, and iterating
+// within a block is just a pointer increment.
+
+#ifndef NP_UTF_CORO_HPP
+#define NP_UTF_CORO_HPP
+
+#ifndef __cpp_impl_coroutine
+#error "utf_coro.hpp requires C++20 coroutine support"
+#endif
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+
+#include "utf.hpp"
+
+namespace utf {
+    namespace internal {
+        // number of values produced per resumption
+        static const size_t generator_block_size = 256;
+
+        template <typename T>
+        struct generator_block {
+            const T* first;
+            const T* last;
+        };
+
+        // yielded by a generator which stops because of an error
+        struct generator_error {};
+    }
+
+    template <typename T>
+    class block_generator {
+    public:
+        struct promise_type {
+            const T* first;
+            const T* last;
+            bool error;
+
+            promise_type() : first(), last(), error(false) {}
+            block_generator get_return_object() { return block_generator(handle_type::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+            std::suspend_always final_suspend() noexcept { return std::suspend_always(); }
+            std::suspend_always yield_value(internal::generator_block<T> b) noexcept {
+                first = b.first;
+                last = b.last;
+                return std::suspend_always();
+            }
+            std::suspend_never yield_value(internal::generator_error) noexcept {
+                error = true;
+                return std::suspend_never();
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+        typedef std::coroutine_handle<promise_type> handle_type;
+
+        class iterator {
+            block_generator* gen;
+            const T* pos;
+
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            iterator() : gen(), pos() {}
+            explicit iterator(block_generator* gen) : gen(gen), pos() {
+                fetch();
+            }
+
+            reference operator*() const { return *pos; }
+            pointer operator->() const { return pos; }
+            iterator& operator++() {
+                if (++pos == gen->block_end()) { fetch(); }
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+
+            friend bool operator == (const iterator& lhs, const iterator& rhs) { return lhs.gen == rhs.gen && lhs.pos == rhs.pos; }
+            friend bool operator != (const iterator& lhs, const iterator& rhs) { return !(lhs == rhs); }
+
+        private:
+            void fetch() {
+                while (gen->next()) {
+                    if (gen->block_begin() != gen->block_end()) {
+                        pos = gen->block_begin();
+                        return;
+                    }
+                }
+                gen = 0;
+                pos = 0;
+            }
+        };
+
+        block_generator(block_generator&& other) noexcept : h(other.h) { other.h = handle_type(); }
+        block_generator& operator = (block_generator&& other) noexcept {
+            std::swap(h, other.h);
+            return *this;
+        }
+        ~block_generator() {
+            if (h) { h.destroy(); }
+        }
+
+        // Advance to the next block. Returns false once the generator is exhausted
+        bool next() {
+            if (h.done()) { return false; }
+            h.resume();
+            return !h.done();
+        }
+        // the current block, valid after next() has returned true
+        const T* block_begin() const { return h.promise().first; }
+        const T* block_end() const { return h.promise().last; }
+        // true if the generator stopped because of malformed input or a
+        // failing source, rather than at the end of its input
+        bool failed() const { return h.promise().error; }
+
+        // iterate over individual values. Can only be done once, and not
+        // mixed with calls to next()
+        iterator begin() { return iterator(this); }
+        iterator end() { return iterator(); }
+
+    private:
+        explicit block_generator(handle_type h) : h(h) {}
+        block_generator(const block_generator&);
+        block_generator& operator = (const block_generator&);
+
+        handle_type h;
+    };
+
+    // Like block_generator, but the producing coroutine may itself co_await
+    // (for example on a socket read). The consumer pulls each block with
+    // `co_await gen.next()`, so nothing is read from the source until the
+    // consumer asks for it.
+    template <typename T>
+    class async_block_generator {
+    public:
+        struct promise_type;
+        typedef std::coroutine_handle<promise_type> handle_type;
+
+        // hand control back to whoever is waiting in next()
+        struct yield_awaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(handle_type h) noexcept { return h.promise().consumer; }
+            void await_resume() noexcept {}
+        };
+
+        struct promise_type {
+            const T* first;
+            const T* last;
+            std::coroutine_handle<> consumer;
+            bool error;
+
+            promise_type() : first(), last(), consumer(), error(false) {}
+            async_block_generator get_return_object() { return async_block_generator(handle_type::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+            yield_awaiter final_suspend() noexcept { return yield_awaiter(); }
+            yield_awaiter yield_value(internal::generator_block<T> b) noexcept {
+                first = b.first;
+                last = b.last;
+                return yield_awaiter();
+            }
+            std::suspend_never yield_value(internal::generator_error) noexcept {
+                error = true;
+                return std::suspend_never();
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        struct next_awaiter {
+            handle_type h;
+
+            bool await_ready() noexcept { return h.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept {
+                h.promise().consumer = consumer;
+                return h;
+            }
+            bool await_resume() noexcept { return !h.done(); }
+        };
+
+        async_block_generator(async_block_generator&& other) noexcept : h(other.h) { other.h = handle_type(); }
+        async_block_generator& operator = (async_block_generator&& other) noexcept {
+            std::swap(h, other.h);
+            return *this;
+        }
+        ~async_block_generator() {
+            if (h) { h.destroy(); }
+        }
+
+        // co_await to advance to the next block. Yields false once the generator is exhausted
+        next_awaiter next() {
+            next_awaiter res = { h };
+            return res;
+        }
+        const T* block_begin() const { return h.promise().first; }
+        const T* block_end() const { return h.promise().last; }
+        // as block_generator::failed
+        bool failed() const { return h.promise().error; }
+
+    private:
+        explicit async_block_generator(handle_type h) : h(h) {}
+        async_block_generator(const async_block_generator&);
+        async_block_generator& operator = (const async_block_generator&);
+
+        handle_type h;
+    };
+
+    namespace internal {
+        // Decode as many whole code points as possible from [first, last)
+        // into dest. Returns the number of code units consumed, or sets
+        // valid to false if they are malformed.
+        template <typename E, typename T>
+        size_t decode_complete(const T* first, const T* last, codepoint_type* dest, size_t& count, bool& valid) {
+            typedef utf_traits<E> traits_t;
+            const T* pos = first;
+            while (pos != last) {
+                size_t len = traits_t::read_length(*pos);
+                if (last - pos < static_cast<ptrdiff_t>(len)) { break; }
+                pos += len;
+            }
+            count = 0;
+            valid = stringview<const T*, E>(first, pos).validate();
+            if (!valid) { return 0; }
+            for (const T* it = first; it != pos; it += traits_t::read_length(*it)) {
+                dest[count++] = traits_t::decode(it);
+            }
+            return pos - first;
+        }
+
+        // State shared by decode_stream and decode_stream_async: the input
+        // buffer, including any sequence carried over from the previous
+        // read, and the code points decoded from it
+        template <typename E>
+        struct stream_decoder {
+            typedef typename utf_traits<E>::codeunit_type unit_type;
+            static const size_t capacity = generator_block_size * 4;
+
+            enum step_result { step_block, step_end, step_error };
+
+            unit_type in[capacity];
+            codepoint_type out[capacity];
+            size_t len;
+
+            stream_decoder() : len(0) {}
+
+            // where the next read should write, and how much room it has
+            unit_type* read_pos() { return in + len; }
+            size_t read_space() const { return capacity - len; }
+
+            // Take the result of a read into read_pos(). On step_block, b
+            // holds the code points it completed, which may be none
+            step_result step(ptrdiff_t read, generator_block<codepoint_type>& b) {
+                if (read < 0) { return step_error; }
+                // input must not end in the middle of a code point
+                if (read == 0) { return len == 0 ? step_end : step_error; }
+                len += static_cast<size_t>(read);
+
+                size_t n = 0;
+                bool valid = true;
+                size_t used = decode_complete<E>(in, in + len, out, n, valid);
+                if (!valid) { return step_error; }
+                std::copy(in + used, in + len, in);
+                len -= used;
+                b.first = out;
+                b.last = out + n;
+                return step_block;
+            }
+        };
+    }
+
+    // the code points of sv
+    template <typename Iter, typename E>
+    block_generator<codepoint_type> codepoints(stringview<Iter, E> sv) {
+        codepoint_type buf[internal::generator_block_size];
+        codepoint_iterator<Iter> it = sv.begin();
+        const codepoint_iterator<Iter> last = sv.end();
+        while (it != last) {
+            size_t n = 0;
+            it = decode_block(it, last, buf, n);
+            internal::generator_block<codepoint_type> b = { buf, buf + n };
+            co_yield b;
+        }
+    }
+
+    // the code units of sv, encoded as EDest
+    template <typename EDest, typename Iter, typename E>
+    block_generator<typename internal::utf_traits<EDest>::codeunit_type> encode(stringview<Iter, E> sv) {
+        typedef typename internal::utf_traits<EDest>::codeunit_type unit_type;
+        // room for one more code point when the block is nearly full
+        unit_type buf[internal::generator_block_size + 4];
+        codepoint_iterator<Iter> it = sv.begin();
+        const codepoint_iterator<Iter> last = sv.end();
+        while (it != last) {
+            unit_type* out = buf;
+            for (; out - buf < static_cast<ptrdiff_t>(internal::generator_block_size) && it != last; ++it) {
+                out = internal::utf_traits<EDest>::encode(*it, out);
+            }
+            internal::generator_block<unit_type> b = { buf, out };
+            co_yield b;
+        }
+    }
+
+    // Decode E-encoded data pulled from source, which is called as
+    // `source(codeunit_type* buf, size_t n)` and returns the number of code
+    // units written to buf as a signed integer: 0 at end of input, and
+    // negative on error, like read(). Sequences split across reads are
+    // carried over. A source error, malformed input, or an incomplete
+    // sequence at the end of input stops the generator, and sets failed().
+    template <typename E, typename Source>
+    block_generator<codepoint_type> decode_stream(Source source) {
+        typedef internal::stream_decoder<E> decoder_type;
+        decoder_type dec;
+        for (;;) {
+            ptrdiff_t read = source(dec.read_pos(), dec.read_space());
+            internal::generator_block<codepoint_type> b;
+            typename decoder_type::step_result r = dec.step(read, b);
+            if (r == decoder_type::step_error) { co_yield internal::generator_error(); }
+            if (r != decoder_type::step_block) { co_return; }
+            if (b.first != b.last) { co_yield b; }
+        }
+    }
+
+    // Like decode_stream, but `source(buf, n)` returns an awaitable which
+    // produces the number of code units read, or a negative value on error
+    template <typename E, typename Source>
+    async_block_generator<codepoint_type> decode_stream_async(Source source) {
+        typedef internal::stream_decoder<E> decoder_type;
+        decoder_type dec;
+        for (;;) {
+            ptrdiff_t read = co_await source(dec.read_pos(), dec.read_space());
+            internal::generator_block<codepoint_type> b;
+            typename decoder_type::step_result r = dec.step(read, b);
+            if (r == decoder_type::step_error) { co_yield internal::generator_error(); }
+            if (r != decoder_type::step_block) { co_return; }
+            if (b.first != b.last) { co_yield b; }
+        }
+    }
+}
+
+#endif
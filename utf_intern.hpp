@@ -0,0 +1,246 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// String interning. Requires C++11.
+//
+// Unlike utf.hpp, this allocates and is meant to be shared between threads.
+
+#ifndef NP_UTF_INTERN_HPP
+#define NP_UTF_INTERN_HPP
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "utf.hpp"
+#include "utf_text.hpp"
+
+namespace utf {
+    // returned by intern_pool for strings it cannot intern or cannot find
+    static const uint32_t invalid_intern_id = 0xffffffff;
+
+    namespace internal {
+        struct intern_record {
+            const char* utf8;
+            size_t len8;
+            size_t hash;
+            // materialized on first use, then never changed
+            std::atomic<const char16_t*> utf16;
+            size_t len16;
+            std::atomic<const char32_t*> utf32;
+            size_t len32;
+        };
+
+        template <typename E>
+        struct intern_alt;
+
+        template <>
+        struct intern_alt<utf16> {
+            static std::atomic<const char16_t*>& units(intern_record& r) { return r.utf16; }
+            static size_t& len(intern_record& r) { return r.len16; }
+        };
+        template <>
+        struct intern_alt<utf32> {
+            static std::atomic<const char32_t*>& units(intern_record& r) { return r.utf32; }
+            static size_t& len(intern_record& r) { return r.len32; }
+        };
+
+        template <typename Pool>
+        struct intern_op {
+            Pool* pool;
+            typename Pool::id_type res;
+            bool insert;
+            template <typename SV>
+            void operator()(const SV& sv) { res = pool->lookup(sv, insert); }
+        };
+    }
+
+    // A set of unique strings, each identified by a 32-bit id.
+    //
+    // Strings are stored once, as UTF-8, no matter which encoding they were
+    // interned from: "café" interned as UTF-8 and as UTF-16 gets the same
+    // id. Views of a string in UTF-16 or UTF-32 are converted on first use
+    // and kept, so each string is converted at most once per encoding.
+    //
+    // The pool is split into stripes, picked by the string's hash, each with
+    // its own lock and arena. Looking up a string by id takes no lock, and
+    // views stay valid for the lifetime of the pool.
+    class intern_pool {
+        static const unsigned stripe_bits = 4;
+        static const unsigned stripe_count = 1u << stripe_bits;
+        // the records of a stripe live in chunks of 256, 512, 1024, ...
+        // pointers, which never move once allocated
+        static const size_t first_chunk = 256;
+        static const unsigned max_chunks = 21;
+
+        struct stripe {
+            std::mutex lock;
+            arena mem;
+            std::vector<uint32_t> slots; // record index + 1, or 0 if empty
+            uint32_t count;
+            std::atomic<internal::intern_record**> chunks[max_chunks];
+            // keep stripes on separate cache lines
+            char padding[64];
+
+            stripe() : count(0) {
+                for (unsigned i = 0; i < max_chunks; ++i) { chunks[i].store(0, std::memory_order_relaxed); }
+            }
+        };
+
+    public:
+        typedef uint32_t id_type;
+
+        intern_pool() : total(0) {}
+
+        // the id of sv, adding it to the pool if it is new. Returns
+        // invalid_intern_id if sv is not valid Unicode, or the pool is full
+        template <typename Iter, typename E>
+        id_type intern(const stringview<Iter, E>& sv) {
+            if (!sv.validate()) { return invalid_intern_id; }
+            return lookup(sv, true);
+        }
+        id_type intern(const any_stringview& sv) {
+            if (!sv.validate()) { return invalid_intern_id; }
+            internal::intern_op<intern_pool> op = { this, invalid_intern_id, true };
+            return sv.visit(op).res;
+        }
+
+        // the id of sv if it has been interned, or invalid_intern_id
+        template <typename Iter, typename E>
+        id_type find(const stringview<Iter, E>& sv) {
+            return lookup(sv, false);
+        }
+        id_type find(const any_stringview& sv) {
+            internal::intern_op<intern_pool> op = { this, invalid_intern_id, false };
+            return sv.visit(op).res;
+        }
+
+        // the string with the given id, as null-terminated UTF-8
+        stringview<const char*> view(id_type id) const {
+            const internal::intern_record& r = record(id);
+            return stringview<const char*>(r.utf8, r.utf8 + r.len8);
+        }
+
+        // the string with the given id, in E. The first call for each id
+        // and encoding converts the string; later ones return the same view
+        template <typename E>
+        stringview<const typename internal::utf_traits<E>::codeunit_type*, E> view_as(id_type id) {
+            typedef typename internal::utf_traits<E>::codeunit_type unit_type;
+            typedef internal::intern_alt<E> alt;
+            internal::intern_record& r = record(id);
+            const unit_type* p = alt::units(r).load(std::memory_order_acquire);
+            if (!p) {
+                stripe& s = stripes[id & (stripe_count - 1)];
+                std::lock_guard<std::mutex> guard(s.lock);
+                p = alt::units(r).load(std::memory_order_relaxed);
+                if (!p) {
+                    stringview<const char*> src(r.utf8, r.utf8 + r.len8);
+                    size_t n = src.codeunits<E>();
+                    unit_type* dest = static_cast<unit_type*>(s.mem.allocate((n + 1) * sizeof(unit_type), sizeof(unit_type)));
+                    *src.to<E>(dest) = 0;
+                    alt::len(r) = n;
+                    alt::units(r).store(dest, std::memory_order_release);
+                    p = dest;
+                }
+            }
+            return stringview<const unit_type*, E>(p, p + alt::len(r));
+        }
+
+        // number of unique strings in the pool
+        size_t size() const { return total.load(std::memory_order_relaxed); }
+
+    private:
+        intern_pool(const intern_pool&);
+        intern_pool& operator = (const intern_pool&);
+
+        template <typename Pool>
+        friend struct internal::intern_op;
+
+        static unsigned chunk_of(uint32_t index, size_t& offset) {
+            size_t j = index / first_chunk + 1;
+            unsigned k = 0;
+            while (j >>= 1) { ++k; }
+            offset = index - first_chunk * ((size_t(1) << k) - 1);
+            return k;
+        }
+
+        internal::intern_record& record(id_type id) const {
+            const stripe& s = stripes[id & (stripe_count - 1)];
+            size_t offset;
+            unsigned k = chunk_of(id >> stripe_bits, offset);
+            return *s.chunks[k].load(std::memory_order_acquire)[offset];
+        }
+
+        template <typename Iter, typename E>
+        id_type lookup(const stringview<Iter, E>& sv, bool insert) {
+            size_t h = hash(sv);
+            unsigned si = h & (stripe_count - 1);
+            stripe& s = stripes[si];
+            std::lock_guard<std::mutex> guard(s.lock);
+
+            size_t mask = s.slots.size() - 1;
+            size_t i = (h >> stripe_bits) & mask;
+            for (; !s.slots.empty() && s.slots[i] != 0; i = (i + 1) & mask) {
+                id_type id = ((s.slots[i] - 1) << stripe_bits) | si;
+                const internal::intern_record& r = record(id);
+                if (r.hash == h && equal(stringview<const char*>(r.utf8, r.utf8 + r.len8), sv)) { return id; }
+            }
+            if (!insert) { return invalid_intern_id; }
+
+            uint32_t index = s.count;
+            size_t offset;
+            unsigned k = chunk_of(index, offset);
+            if (k >= max_chunks || index > (invalid_intern_id >> stripe_bits) - 1) { return invalid_intern_id; }
+            internal::intern_record** chunk = s.chunks[k].load(std::memory_order_relaxed);
+            if (!chunk) {
+                size_t n = first_chunk << k;
+                chunk = static_cast<internal::intern_record**>(s.mem.allocate(n * sizeof(internal::intern_record*), sizeof(void*)));
+                s.chunks[k].store(chunk, std::memory_order_release);
+            }
+
+            size_t len = sv.template codeunits<utf8>();
+            char* units = static_cast<char*>(s.mem.allocate(len + 1, 1));
+            *sv.template to<utf8>(units) = 0;
+            internal::intern_record* r = new (s.mem.allocate(sizeof(internal::intern_record), alignof(internal::intern_record))) internal::intern_record();
+            r->utf8 = units;
+            r->len8 = len;
+            r->hash = h;
+            r->utf16.store(0, std::memory_order_relaxed);
+            r->len16 = 0;
+            r->utf32.store(0, std::memory_order_relaxed);
+            r->len32 = 0;
+            chunk[offset] = r;
+            ++s.count;
+            total.fetch_add(1, std::memory_order_relaxed);
+
+            if ((s.count + 1) * 2 > s.slots.size()) {
+                grow(s, si);
+            }
+            else {
+                s.slots[i] = index + 1;
+            }
+            return (index << stripe_bits) | si;
+        }
+
+        // rebuild the stripe's table at twice the size, with all its records
+        void grow(stripe& s, unsigned si) {
+            std::vector<uint32_t> slots(s.slots.empty() ? 64 : s.slots.size() * 2, 0);
+            size_t mask = slots.size() - 1;
+            for (uint32_t index = 0; index < s.count; ++index) {
+                const internal::intern_record& r = record((index << stripe_bits) | si);
+                size_t i = (r.hash >> stripe_bits) & mask;
+                while (slots[i] != 0) { i = (i + 1) & mask; }
+                slots[i] = index + 1;
+            }
+            s.slots.swap(slots);
+        }
+
+        stripe stripes[stripe_count];
+        std::atomic<size_t> total;
+    };
+}
+
+#endif
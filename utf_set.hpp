@@ -0,0 +1,195 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Sets of code points, and bulk operations on the members of a set found
+// in a string. Requires C++11.
+
+#ifndef NP_UTF_SET_HPP
+#define NP_UTF_SET_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "utf.hpp"
+
+namespace utf {
+    // A set of code points, stored as an inversion list: a sorted list of
+    // boundaries, where each even entry starts a range of members and each
+    // odd entry ends one. Membership of ASCII code points is kept in a
+    // separate 128-bit bitmap, so it costs a single bit test.
+    class codepoint_set {
+    public:
+        static const codepoint_type max_codepoint = 0x10ffff;
+
+        codepoint_set() { ascii[0] = ascii[1] = 0; }
+        // the code points from first to last, inclusive
+        codepoint_set(codepoint_type first, codepoint_type last) {
+            if (last > max_codepoint) { last = max_codepoint; }
+            if (first <= last) {
+                list.push_back(first);
+                list.push_back(last + 1);
+            }
+            update_ascii();
+        }
+        // the code points occurring in chars
+        template <typename Iter, typename E>
+        explicit codepoint_set(const stringview<Iter, E>& chars) {
+            std::vector<codepoint_type> members(chars.begin(), chars.end());
+            std::sort(members.begin(), members.end());
+            for (size_t i = 0; i < members.size(); ++i) {
+                if (!list.empty() && list.back() == members[i]) { ++list.back(); }
+                else if (list.empty() || list.back() < members[i]) {
+                    list.push_back(members[i]);
+                    list.push_back(members[i] + 1);
+                }
+            }
+            update_ascii();
+        }
+
+        bool contains(codepoint_type c) const {
+            if (c < 0x80) { return (ascii[c >> 6] >> (c & 63)) & 1; }
+            return (std::upper_bound(list.begin(), list.end(), c) - list.begin()) & 1;
+        }
+        bool empty() const { return list.empty(); }
+        bool has_ascii() const { return (ascii[0] | ascii[1]) != 0; }
+        // number of code points in the set
+        size_t size() const {
+            size_t n = 0;
+            for (size_t i = 0; i < list.size(); i += 2) { n += list[i + 1] - list[i]; }
+            return n;
+        }
+        // the inversion list
+        const std::vector<codepoint_type>& boundaries() const { return list; }
+
+        codepoint_set& insert(codepoint_type c) { return insert(c, c); }
+        codepoint_set& insert(codepoint_type first, codepoint_type last) { return *this |= codepoint_set(first, last); }
+        codepoint_set& erase(codepoint_type c) { return erase(c, c); }
+        codepoint_set& erase(codepoint_type first, codepoint_type last) { return *this -= codepoint_set(first, last); }
+
+        codepoint_set& operator |= (const codepoint_set& rhs) { return *this = combine(*this, rhs, union_op); }
+        codepoint_set& operator &= (const codepoint_set& rhs) { return *this = combine(*this, rhs, intersection_op); }
+        codepoint_set& operator -= (const codepoint_set& rhs) { return *this = combine(*this, rhs, difference_op); }
+        codepoint_set& operator ^= (const codepoint_set& rhs) { return *this = combine(*this, rhs, symmetric_difference_op); }
+
+        friend codepoint_set operator | (const codepoint_set& lhs, const codepoint_set& rhs) { return combine(lhs, rhs, union_op); }
+        friend codepoint_set operator & (const codepoint_set& lhs, const codepoint_set& rhs) { return combine(lhs, rhs, intersection_op); }
+        friend codepoint_set operator - (const codepoint_set& lhs, const codepoint_set& rhs) { return combine(lhs, rhs, difference_op); }
+        friend codepoint_set operator ^ (const codepoint_set& lhs, const codepoint_set& rhs) { return combine(lhs, rhs, symmetric_difference_op); }
+        // every code point not in the set
+        friend codepoint_set operator ~ (const codepoint_set& set) {
+            codepoint_set res;
+            if (set.list.empty() || set.list.front() != 0) { res.list.push_back(0); }
+            res.list.insert(res.list.end(), set.list.begin() + (!set.list.empty() && set.list.front() == 0), set.list.end());
+            if (!res.list.empty() && res.list.back() == max_codepoint + 1) { res.list.pop_back(); }
+            else { res.list.push_back(max_codepoint + 1); }
+            res.update_ascii();
+            return res;
+        }
+
+        friend bool operator == (const codepoint_set& lhs, const codepoint_set& rhs) { return lhs.list == rhs.list; }
+        friend bool operator != (const codepoint_set& lhs, const codepoint_set& rhs) { return !(lhs == rhs); }
+
+    private:
+        // truth tables, indexed by (in lhs) * 2 + (in rhs)
+        static const unsigned union_op = 0xe;
+        static const unsigned intersection_op = 0x8;
+        static const unsigned difference_op = 0x4;
+        static const unsigned symmetric_difference_op = 0x6;
+
+        // merge the inversion lists of lhs and rhs, keeping the code points
+        // for which op is true
+        static codepoint_set combine(const codepoint_set& lhs, const codepoint_set& rhs, unsigned op) {
+            codepoint_set res;
+            const std::vector<codepoint_type>& a = lhs.list;
+            const std::vector<codepoint_type>& b = rhs.list;
+            res.list.reserve(a.size() + b.size());
+            size_t i = 0, j = 0;
+            bool in = false;
+            while (i < a.size() || j < b.size()) {
+                codepoint_type c = i == a.size() ? b[j] : j == b.size() ? a[i] : std::min(a[i], b[j]);
+                if (i < a.size() && a[i] == c) { ++i; }
+                if (j < b.size() && b[j] == c) { ++j; }
+                bool member = (op >> ((i & 1) * 2 + (j & 1))) & 1;
+                if (member != in) {
+                    res.list.push_back(c);
+                    in = member;
+                }
+            }
+            res.update_ascii();
+            return res;
+        }
+
+        void update_ascii() {
+            ascii[0] = ascii[1] = 0;
+            for (size_t i = 0; i < list.size() && list[i] < 0x80; i += 2) {
+                codepoint_type end = std::min<codepoint_type>(list[i + 1], 0x80);
+                for (codepoint_type c = list[i]; c < end; ++c) {
+                    ascii[c >> 6] |= uint64_t(1) << (c & 63);
+                }
+            }
+        }
+
+        std::vector<codepoint_type> list;
+        uint64_t ascii[2];
+    };
+
+    namespace internal {
+        // split_any finder for a codepoint_set, which must outlive the range
+        template <typename E, typename Iter>
+        struct codepoint_set_finder {
+            const codepoint_set* set;
+
+            Iter find(Iter first, Iter last, size_t& match_len) const {
+                return set_scan<E, Iter>::find(first, last, *set, match_len);
+            }
+        };
+    }
+
+    // The rest of sv from its first code point which is in set, or an empty
+    // view at sv.end(). The result keeps the encoding E of sv, like the
+    // pieces of split_any.
+    template <typename Iter, typename E>
+    stringview<Iter, E> find(const stringview<Iter, E>& sv, const codepoint_set& set) {
+        size_t len = 0;
+        const Iter last = sv.end().base();
+        return stringview<Iter, E>(internal::set_scan<E, Iter>::find(sv.begin().base(), last, set, len), last);
+    }
+
+    // The number of code points of sv which are in set
+    template <typename Iter, typename E>
+    size_t count(const stringview<Iter, E>& sv, const codepoint_set& set) {
+        size_t n = 0;
+        size_t len = 0;
+        Iter last = sv.end().base();
+        for (Iter it = internal::set_scan<E, Iter>::find(sv.begin().base(), last, set, len); it != last; it = internal::set_scan<E, Iter>::find(it + len, last, set, len)) {
+            ++n;
+        }
+        return n;
+    }
+
+    // Copy the code units of sv to dest, leaving out the code points which
+    // are in set. The runs in between are copied without being re-encoded.
+    template <typename Iter, typename E, typename OutIt>
+    OutIt strip(const stringview<Iter, E>& sv, const codepoint_set& set, OutIt dest) {
+        size_t len = 0;
+        Iter first = sv.begin().base();
+        Iter last = sv.end().base();
+        for (;;) {
+            Iter it = internal::set_scan<E, Iter>::find(first, last, set, len);
+            dest = std::copy(first, it, dest);
+            if (it == last) { return dest; }
+            first = it + len;
+        }
+    }
+
+    // The pieces of sv separated by members of set
+    template <typename Iter, typename E>
+    split_range<Iter, E, internal::codepoint_set_finder<E, Iter> > split_any(const stringview<Iter, E>& sv, const codepoint_set& set) {
+        internal::codepoint_set_finder<E, Iter> finder = { &set };
+        return split_range<Iter, E, internal::codepoint_set_finder<E, Iter> >(sv.begin().base(), sv.end().base(), finder);
+    }
+}
+
+#endif
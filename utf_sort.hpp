@@ -0,0 +1,246 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Sorting large numbers of strings in code point order. Requires C++11.
+//
+// Unlike utf.hpp, this allocates (scratch space proportional to the number
+// of strings) and may start threads.
+
+#ifndef NP_UTF_SORT_HPP
+#define NP_UTF_SORT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utf.hpp"
+
+namespace utf {
+    namespace internal {
+        // Code point order for each encoding, as an unsigned key unit per
+        // code unit. Comparing keys bytewise, most significant byte first,
+        // gives code point order.
+        template <typename E>
+        struct sort_key;
+
+        template <>
+        struct sort_key<utf8> {
+            typedef uint8_t type;
+            template <typename T>
+            static type get(T c) { return static_cast<uint8_t>(c); }
+        };
+        template <>
+        struct sort_key<utf16> {
+            typedef uint16_t type;
+            template <typename T>
+            static type get(T c) { return utf16_fixup(static_cast<uint16_t>(c)); }
+        };
+        template <>
+        struct sort_key<utf32> {
+            typedef uint32_t type;
+            template <typename T>
+            static type get(T c) { return static_cast<uint32_t>(c); }
+        };
+
+        template <typename T>
+        struct sort_entry {
+            // the next 8 key bytes from the current depth, so the inner
+            // loops only touch the entry array rather than the strings
+            uint64_t cache;
+            const T* data;
+            size_t key_len; // in bytes
+            size_t index;
+        };
+
+        template <typename T>
+        class radix_sorter {
+            typedef typename native_encoding<T>::type encoding;
+            typedef sort_key<encoding> key_type;
+            static const size_t unit_bytes = sizeof(typename key_type::type);
+            // below this, buckets are finished off with std::sort
+            static const size_t small_bucket = 32;
+
+        public:
+            radix_sorter(sort_entry<T>* entries, sort_entry<T>* scratch) : entries(entries), scratch(scratch) {}
+
+            void sort(size_t first, size_t last, size_t depth) {
+                size_t bounds[258];
+                while (last - first >= small_bucket) {
+                    split(first, last, depth, bounds);
+                    // strings which end here are all equal, so bucket 0 is done.
+                    // Recurse into all buckets but the largest, and loop on that
+                    size_t largest = 1;
+                    for (size_t b = 2; b < 257; ++b) {
+                        if (bounds[b + 1] - bounds[b] > bounds[largest + 1] - bounds[largest]) { largest = b; }
+                    }
+                    for (size_t b = 1; b < 257; ++b) {
+                        if (b != largest && bounds[b + 1] - bounds[b] > 1) { sort(bounds[b], bounds[b + 1], depth + 1); }
+                    }
+                    first = bounds[largest];
+                    last = bounds[largest + 1];
+                    ++depth;
+                }
+                finish(first, last, depth);
+            }
+
+            // Split [first, last) into buckets by the key byte at depth.
+            // Bucket b occupies [bounds[b], bounds[b + 1]). Bucket 0 holds the
+            // strings that are shorter than depth + 1 bytes.
+            void split(size_t first, size_t last, size_t depth, size_t* bounds) {
+                if (depth % 8 == 0) { fill_cache(first, last, depth); }
+                distribute(first, last, depth, bounds);
+            }
+
+            // Split [first, last) by the key byte at the first depth where
+            // the strings don't all fall into the same bucket, and return
+            // that depth. Strings which share a long prefix, such as UTF-32
+            // or ASCII UTF-16 whose high bytes are all zero, would otherwise
+            // end up in a single bucket.
+            size_t split_distinct(size_t first, size_t last, size_t* bounds) {
+                for (size_t depth = 0;; ++depth) {
+                    split(first, last, depth, bounds);
+                    size_t only = 0;
+                    for (size_t b = 1; b < 257; ++b) {
+                        if (bounds[b + 1] == bounds[b]) { continue; }
+                        if (only != 0) { return depth; }
+                        only = b;
+                    }
+                    // every string has ended, so they are all equal
+                    if (only == 0) { return depth; }
+                    first = bounds[only];
+                    last = bounds[only + 1];
+                }
+            }
+
+        private:
+            void distribute(size_t first, size_t last, size_t depth, size_t* bounds) {
+                size_t counts[257] = {};
+                for (size_t i = first; i < last; ++i) {
+                    ++counts[bucket(entries[i], depth)];
+                }
+                bounds[0] = first;
+                for (size_t b = 0; b < 257; ++b) {
+                    bounds[b + 1] = bounds[b] + counts[b];
+                }
+                if (counts[bucket(entries[first], depth)] == last - first) { return; }
+
+                size_t next[257];
+                std::copy(bounds, bounds + 257, next);
+                for (size_t i = first; i < last; ++i) {
+                    scratch[next[bucket(entries[i], depth)]++] = entries[i];
+                }
+                std::copy(scratch + first, scratch + last, entries + first);
+            }
+
+            static size_t bucket(const sort_entry<T>& e, size_t depth) {
+                if (depth >= e.key_len) { return 0; }
+                return 1 + ((e.cache >> (56 - 8 * (depth % 8))) & 0xff);
+            }
+
+            static uint8_t key_byte(const sort_entry<T>& e, size_t depth) {
+                typename key_type::type unit = key_type::get(e.data[depth / unit_bytes]);
+                return static_cast<uint8_t>(unit >> (8 * (unit_bytes - 1 - depth % unit_bytes)));
+            }
+
+            void fill_cache(size_t first, size_t last, size_t depth) {
+                for (size_t i = first; i < last; ++i) {
+                    sort_entry<T>& e = entries[i];
+                    uint64_t c = 0;
+                    for (size_t d = depth; d < depth + 8; ++d) {
+                        c = (c << 8) | (d < e.key_len ? key_byte(e, d) : 0);
+                    }
+                    e.cache = c;
+                }
+            }
+
+            struct less {
+                size_t depth;
+                bool operator()(const sort_entry<T>& lhs, const sort_entry<T>& rhs) const {
+                    // the first depth bytes are known to be equal
+                    size_t skip = depth / unit_bytes;
+                    const T* l = lhs.data + skip;
+                    const T* r = rhs.data + skip;
+                    return compare(stringview<const T*>(l, lhs.data + lhs.key_len / unit_bytes)
+                        , stringview<const T*>(r, rhs.data + rhs.key_len / unit_bytes)) < 0;
+                }
+            };
+
+            void finish(size_t first, size_t last, size_t depth) {
+                less cmp = { depth };
+                std::sort(entries + first, entries + last, cmp);
+            }
+
+            sort_entry<T>* entries;
+            sort_entry<T>* scratch;
+        };
+    }
+
+    // Sort the strings in [first, last) in code point order. The elements
+    // must provide data() and size() over contiguous code units, such as
+    // std::string, std::u16string or std::u32string_view; the encoding is
+    // deduced from the code unit size.
+    //
+    // This is an MSD radix sort, which never decodes: UTF-8 and UTF-32 are
+    // sorted by their code units directly, UTF-16 with the surrogate
+    // fix-up applied on the fly. Large inputs are split at the first key
+    // byte where the strings differ, and the buckets are sorted in parallel
+    // on up to `threads` threads (0 means one per hardware thread).
+    template <typename RandomIt>
+    void sort_codepoint_order(RandomIt first, RandomIt last, unsigned threads = 0) {
+        typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+        typedef typename std::remove_cv<typename std::remove_pointer<decltype((*first).data())>::type>::type unit_type;
+        typedef internal::sort_entry<unit_type> entry_type;
+
+        const size_t n = last - first;
+        if (n < 2) { return; }
+
+        std::vector<entry_type> entries(n);
+        std::vector<entry_type> scratch(n);
+        for (size_t i = 0; i < n; ++i) {
+            entry_type e = { 0, first[i].data(), first[i].size() * sizeof(unit_type), i };
+            entries[i] = e;
+        }
+
+        internal::radix_sorter<unit_type> sorter(entries.data(), scratch.data());
+        if (threads == 0) { threads = std::thread::hardware_concurrency(); }
+        if (threads <= 1 || n < 65536) {
+            sorter.sort(0, n, 0);
+        }
+        else {
+            // split until there is more than one bucket, then hand out
+            // buckets to the threads. Buckets are disjoint, so the threads
+            // share entries and scratch
+            size_t bounds[258];
+            const size_t depth = sorter.split_distinct(0, n, bounds);
+            std::atomic<size_t> next_bucket(1);
+            std::vector<std::thread> pool;
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.push_back(std::thread([&]() {
+                    internal::radix_sorter<unit_type> local(entries.data(), scratch.data());
+                    for (size_t b; (b = next_bucket.fetch_add(1)) < 257; ) {
+                        if (bounds[b + 1] - bounds[b] > 1) { local.sort(bounds[b], bounds[b + 1], depth + 1); }
+                    }
+                }));
+            }
+            for (size_t t = 0; t < pool.size(); ++t) {
+                pool[t].join();
+            }
+        }
+
+        // apply the permutation
+        std::vector<value_type> sorted;
+        sorted.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            sorted.push_back(std::move(first[entries[i].index]));
+        }
+        std::move(sorted.begin(), sorted.end(), first);
+    }
+}
+
+#endif
@@ -0,0 +1,808 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Owning text types on top of utf.hpp. Requires C++11.
+//
+// utf.hpp itself never allocates. Everything in here does, through a
+// user-supplied allocator, so it lives in a separate header.
+
+#ifndef NP_UTF_TEXT_HPP
+#define NP_UTF_TEXT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
+
+#include "utf.hpp"
+
+namespace utf {
+    namespace internal {
+        // true if every code unit in [first, last) is below 0x80
+        template <typename T>
+        bool is_ascii(const T* first, const T* last) {
+            if (sizeof(T) == 1) {
+                for (; last - first >= 8; first += 8) {
+                    if (!ascii8(first)) { return false; }
+                }
+            }
+            unsigned high = 0;
+            for (; first != last; ++first) {
+                high |= static_cast<uint32_t>(*first) >= 0x80;
+            }
+            return high == 0;
+        }
+
+        // Lazily computed facts about a piece of text, packed into a single
+        // word so they can be cached in an immutable object shared between
+        // threads: computing a fact twice is harmless, since both threads
+        // store the same bits.
+        class text_meta {
+            enum {
+                validated = 1, valid = 2,
+                ascii_known = 4, ascii = 8,
+                counted = 16,
+                count_shift = 5
+            };
+            mutable std::atomic<uint64_t> bits;
+
+        public:
+            text_meta() : bits(0) {}
+            text_meta(const text_meta& other) : bits(other.bits.load(std::memory_order_relaxed)) {}
+            text_meta& operator = (const text_meta& other) {
+                bits.store(other.bits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                return *this;
+            }
+
+            void reset() { bits.store(0, std::memory_order_relaxed); }
+
+            template <typename E, typename T>
+            bool validate(const T* first, const T* last) const {
+                uint64_t b = bits.load(std::memory_order_relaxed);
+                if (!(b & validated)) {
+                    b = stringview<const T*, E>(first, last).validate() ? validated | valid : validated;
+                    bits.fetch_or(b, std::memory_order_relaxed);
+                }
+                return (b & valid) != 0;
+            }
+
+            template <typename T>
+            bool is_ascii(const T* first, const T* last) const {
+                uint64_t b = bits.load(std::memory_order_relaxed);
+                if (!(b & ascii_known)) {
+                    b = internal::is_ascii(first, last) ? ascii_known | ascii : ascii_known;
+                    bits.fetch_or(b, std::memory_order_relaxed);
+                }
+                return (b & ascii) != 0;
+            }
+
+            template <typename E, typename T>
+            size_t codepoints(const T* first, const T* last) const {
+                uint64_t b = bits.load(std::memory_order_relaxed);
+                if (!(b & counted)) {
+                    b = counted | (static_cast<uint64_t>(stringview<const T*, E>(first, last).codepoints()) << count_shift);
+                    bits.fetch_or(b, std::memory_order_relaxed);
+                }
+                return static_cast<size_t>(b >> count_shift);
+            }
+
+            bool known_valid() const {
+                return (bits.load(std::memory_order_relaxed) & (validated | valid)) == (validated | valid);
+            }
+        };
+    }
+
+    // An immutable, owning string of E-encoded code units.
+    //
+    // Short strings are stored inline, longer ones in a single exactly sized
+    // allocation. The data is always followed by a null code unit, so
+    // c_str() is available. Whether the text is valid, whether it is pure
+    // ASCII and how many code points it holds are computed on first use and
+    // cached.
+    template <typename E, typename Alloc = std::allocator<typename internal::utf_traits<E>::codeunit_type> >
+    class basic_text {
+    public:
+        typedef E encoding;
+        typedef typename internal::utf_traits<E>::codeunit_type value_type;
+        typedef Alloc allocator_type;
+        typedef const value_type* const_iterator;
+        typedef const value_type* iterator;
+
+    private:
+        typedef std::allocator_traits<Alloc> alloc_traits;
+        // code units (excluding the terminator) which fit without allocating
+        static const size_t inline_units = 16 / sizeof(value_type) - 1;
+
+    public:
+        basic_text() : rep(Alloc()) {}
+        explicit basic_text(const Alloc& alloc) : rep(alloc) {}
+
+        // copy code units which are already E-encoded
+        basic_text(const value_type* first, const value_type* last, const Alloc& alloc = Alloc()) : rep(alloc) {
+            std::copy(first, last, allocate(last - first));
+        }
+
+        // transcode sv from whichever encoding it is in
+        template <typename Iter, typename ESrc>
+        explicit basic_text(const stringview<Iter, ESrc>& sv, const Alloc& alloc = Alloc()) : rep(alloc) {
+            sv.template to<E>(allocate(sv.template codeunits<E>()));
+        }
+
+        basic_text(const basic_text& other)
+        : rep(alloc_traits::select_on_container_copy_construction(other.get_allocator())) {
+            std::copy(other.begin(), other.end(), allocate(other.size()));
+            meta = other.meta;
+        }
+
+        basic_text(basic_text&& other) noexcept : rep(std::move(other.rep)) {
+            steal(other);
+        }
+
+        ~basic_text() { release(); }
+
+        basic_text& operator = (const basic_text& other) {
+            if (this != &other) {
+                basic_text tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        basic_text& operator = (basic_text&& other) {
+            if (this == &other) { return *this; }
+            if (!alloc_traits::propagate_on_container_move_assignment::value && !(get_allocator() == other.get_allocator())) {
+                // can't take over memory from a different allocator. Copy
+                // it with ours first, so if that throws, *this is unchanged
+                basic_text tmp(other.begin(), other.end(), get_allocator());
+                tmp.meta = other.meta;
+                release();
+                steal(tmp);
+                return *this;
+            }
+            release();
+            if (alloc_traits::propagate_on_container_move_assignment::value) {
+                static_cast<Alloc&>(rep) = std::move(static_cast<Alloc&>(other.rep));
+            }
+            steal(other);
+            return *this;
+        }
+
+        void swap(basic_text& other) {
+            basic_text tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        allocator_type get_allocator() const { return rep; }
+
+        const value_type* data() const { return rep.ptr; }
+        const value_type* c_str() const { return rep.ptr; }
+        const_iterator begin() const { return rep.ptr; }
+        const_iterator end() const { return rep.ptr + rep.len; }
+
+        bool empty() const { return rep.len == 0; }
+        size_t size() const { return rep.len; }
+        size_t codeunits() const { return rep.len; }
+        size_t bytes() const { return rep.len * sizeof(value_type); }
+
+        stringview<const value_type*, E> view() const { return stringview<const value_type*, E>(begin(), end()); }
+
+        bool validate() const { return meta.template validate<E>(begin(), end()); }
+        bool is_ascii() const { return meta.is_ascii(begin(), end()); }
+        size_t codepoints() const { return meta.template codepoints<E>(begin(), end()); }
+
+        // the same text in another encoding
+        template <typename EDest>
+        basic_text<EDest, typename alloc_traits::template rebind_alloc<typename internal::utf_traits<EDest>::codeunit_type> > to() const {
+            typedef typename alloc_traits::template rebind_alloc<typename internal::utf_traits<EDest>::codeunit_type> dest_alloc;
+            basic_text<EDest, dest_alloc> res(view(), dest_alloc(get_allocator()));
+            res.copy_meta(meta);
+            return res;
+        }
+
+        friend bool operator == (const basic_text& lhs, const basic_text& rhs) { return equal(lhs.view(), rhs.view()); }
+        friend bool operator != (const basic_text& lhs, const basic_text& rhs) { return !(lhs == rhs); }
+        // code point order
+        friend bool operator < (const basic_text& lhs, const basic_text& rhs) { return compare(lhs.view(), rhs.view()) < 0; }
+
+    private:
+        template <typename, typename>
+        friend class basic_text;
+
+        // Everything cached describes code points rather than code units, so
+        // it carries over to a transcoded copy of valid text
+        void copy_meta(const internal::text_meta& src) {
+            if (src.known_valid()) { meta = src; }
+        }
+
+        // make room for n code units plus terminator, and return where to write them
+        value_type* allocate(size_t n) {
+            rep.len = n;
+            if (n <= inline_units) {
+                rep.ptr = rep.buf;
+            }
+            else {
+                rep.cap = n + 1;
+                rep.ptr = alloc_traits::allocate(rep, rep.cap);
+            }
+            rep.ptr[n] = value_type();
+            return rep.ptr;
+        }
+
+        void release() {
+            if (rep.ptr && rep.ptr != rep.buf) {
+                alloc_traits::deallocate(rep, rep.ptr, rep.cap);
+            }
+        }
+
+        // take over other's contents, leaving it empty
+        void steal(basic_text& other) {
+            rep.len = other.rep.len;
+            if (other.rep.ptr == other.rep.buf) {
+                std::copy(other.rep.buf, other.rep.buf + inline_units + 1, rep.buf);
+                rep.ptr = rep.buf;
+            }
+            else {
+                rep.ptr = other.rep.ptr;
+                rep.cap = other.rep.cap;
+            }
+            meta = other.meta;
+            other.rep.ptr = other.rep.buf;
+            other.rep.len = 0;
+            other.rep.buf[0] = value_type();
+            other.meta.reset();
+        }
+
+        // derives from the allocator so a stateless one takes up no space
+        struct storage : Alloc {
+            value_type* ptr;
+            size_t len;
+            union {
+                size_t cap;
+                value_type buf[inline_units + 1];
+            };
+
+            explicit storage(const Alloc& alloc) : Alloc(alloc), ptr(buf), len(0) {
+                buf[0] = value_type();
+            }
+        };
+
+        storage rep;
+        internal::text_meta meta;
+    };
+
+    typedef basic_text<utf8> text8;
+    typedef basic_text<utf16> text16;
+    typedef basic_text<utf32> text32;
+
+    namespace internal {
+        struct max_codepoint {
+            codepoint_type max;
+            size_t count;
+            void operator()(codepoint_type c) {
+                max = c > max ? c : max;
+                ++count;
+            }
+        };
+
+        template <typename T>
+        struct narrow_to {
+            T* dest;
+            void operator()(codepoint_type c) { *dest++ = static_cast<T>(c); }
+        };
+
+        template <typename EDest>
+        struct count_units {
+            size_t count;
+            void operator()(codepoint_type c) { count += utf_traits<EDest>::write_length(c); }
+        };
+    }
+
+    // Text stored as an array of fixed-width code points, using the
+    // narrowest width which fits every code point in it: 1 byte (Latin-1),
+    // 2 bytes (UCS-2) or 4 bytes (UCS-4). Indexing by code point is O(1),
+    // and most text takes less memory than UTF-32 would.
+    template <typename Alloc = std::allocator<char32_t> >
+    class basic_compact_text {
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<char32_t> word_alloc;
+        typedef std::allocator_traits<word_alloc> alloc_traits;
+
+    public:
+        typedef Alloc allocator_type;
+
+        basic_compact_text() : rep(Alloc()), count(0), max(0), width_(1) {}
+
+        // Two passes over sv: one to find the largest code point, and one to
+        // store the code points at the width that requires
+        template <typename Iter, typename E>
+        explicit basic_compact_text(const stringview<Iter, E>& sv, const Alloc& alloc = Alloc()) : rep(alloc) {
+            internal::max_codepoint m = { 0, 0 };
+            m = for_each_codepoint(sv, m);
+            count = m.count;
+            max = m.max;
+            width_ = m.max < 0x100 ? 1 : (m.max < 0x10000 ? 2 : 4);
+            allocate();
+            switch (width_) {
+                case 1: { internal::narrow_to<uint8_t> n = { static_cast<uint8_t*>(rep.data) }; for_each_codepoint(sv, n); break; }
+                case 2: { internal::narrow_to<char16_t> n = { static_cast<char16_t*>(rep.data) }; for_each_codepoint(sv, n); break; }
+                case 4: { internal::narrow_to<char32_t> n = { static_cast<char32_t*>(rep.data) }; for_each_codepoint(sv, n); break; }
+            }
+        }
+
+        basic_compact_text(const basic_compact_text& other)
+        : rep(alloc_traits::select_on_container_copy_construction(other.rep)), count(other.count), max(other.max), width_(other.width_) {
+            allocate();
+            if (bytes() != 0) { std::memcpy(rep.data, other.rep.data, bytes()); }
+        }
+
+        basic_compact_text(basic_compact_text&& other) noexcept
+        : rep(std::move(other.rep)), count(other.count), max(other.max), width_(other.width_) {
+            other.rep.data = 0;
+            other.count = 0;
+            other.max = 0;
+        }
+
+        ~basic_compact_text() { release(); }
+
+        basic_compact_text& operator = (basic_compact_text other) {
+            std::swap(static_cast<word_alloc&>(rep), static_cast<word_alloc&>(other.rep));
+            std::swap(rep.data, other.rep.data);
+            std::swap(count, other.count);
+            std::swap(max, other.max);
+            std::swap(width_, other.width_);
+            return *this;
+        }
+
+        allocator_type get_allocator() const { return allocator_type(rep); }
+
+        // number of code points
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        // bytes per code point
+        unsigned width() const { return width_; }
+        // storage used by the code points
+        size_t bytes() const { return count * width_; }
+        bool is_ascii() const { return max < 0x80; }
+        codepoint_type max_codepoint() const { return max; }
+
+        codepoint_type operator[](size_t i) const {
+            switch (width_) {
+                case 1: return static_cast<const uint8_t*>(rep.data)[i];
+                case 2: return static_cast<const char16_t*>(rep.data)[i];
+                default: return static_cast<const char32_t*>(rep.data)[i];
+            }
+        }
+
+        template <typename EDest>
+        size_t codeunits() const {
+            switch (width_) {
+                case 1:
+                {
+                    internal::count_units<EDest> c = { 0 };
+                    const uint8_t* p = static_cast<const uint8_t*>(rep.data);
+                    for (size_t i = 0; i < count; ++i) { c(p[i]); }
+                    return c.count;
+                }
+                case 2: return ucs2().template codeunits<EDest>();
+                default: return ucs4().template codeunits<EDest>();
+            }
+        }
+
+        template <typename EDest>
+        size_t bytes() const {
+            return codeunits<EDest>() * sizeof(typename internal::utf_traits<EDest>::codeunit_type);
+        }
+
+        // Encode as EDest. UCS-2 is valid UTF-16 and UCS-4 is UTF-32, so
+        // those go through the regular stringview conversions
+        template <typename EDest, typename OutIt>
+        OutIt to(OutIt dest) const {
+            switch (width_) {
+                case 1:
+                {
+                    internal::encoder<EDest, OutIt> enc = { dest };
+                    const uint8_t* p = static_cast<const uint8_t*>(rep.data);
+                    for (size_t i = 0; i < count; ++i) { enc(p[i]); }
+                    return enc.dest;
+                }
+                case 2: return ucs2().template to<EDest>(dest);
+                default: return ucs4().template to<EDest>(dest);
+            }
+        }
+
+    private:
+        stringview<const char16_t*> ucs2() const {
+            const char16_t* p = static_cast<const char16_t*>(rep.data);
+            return stringview<const char16_t*>(p, p + (width_ == 2 ? count : 0));
+        }
+        stringview<const char32_t*> ucs4() const {
+            const char32_t* p = static_cast<const char32_t*>(rep.data);
+            return stringview<const char32_t*>(p, p + (width_ == 4 ? count : 0));
+        }
+
+        // allocate room for count code points of width_ bytes
+        void allocate() {
+            size_t words = (bytes() + sizeof(char32_t) - 1) / sizeof(char32_t);
+            rep.data = words != 0 ? alloc_traits::allocate(rep, words) : 0;
+        }
+
+        void release() {
+            if (rep.data) {
+                alloc_traits::deallocate(rep, static_cast<char32_t*>(rep.data), (bytes() + sizeof(char32_t) - 1) / sizeof(char32_t));
+            }
+        }
+
+        struct storage : word_alloc {
+            void* data;
+            explicit storage(const word_alloc& alloc) : word_alloc(alloc), data(0) {}
+        };
+
+        storage rep;
+        size_t count;
+        codepoint_type max;
+        unsigned width_;
+    };
+
+    typedef basic_compact_text<> compact_text;
+
+    namespace internal {
+        // the shared part of a basic_shared_text. The code units follow it
+        // in the same allocation
+        template <typename T>
+        struct shared_text_rep {
+            std::atomic<size_t> refs;
+            size_t len;
+            text_meta meta;
+            // the text in each encoding, indexed by encoding_id. Published
+            // once, and freed along with the rep
+            std::atomic<void*> alts[3];
+            size_t alt_len[3];
+            std::once_flag once[3];
+
+            explicit shared_text_rep(size_t len) : refs(1), len(len) {
+                for (int i = 0; i < 3; ++i) {
+                    alts[i].store(0, std::memory_order_relaxed);
+                    alt_len[i] = 0;
+                }
+            }
+            ~shared_text_rep() {
+                for (int i = 0; i < 3; ++i) { ::operator delete(alts[i].load(std::memory_order_relaxed)); }
+            }
+
+            T* data() { return reinterpret_cast<T*>(this + 1); }
+
+            static shared_text_rep* create(size_t len) {
+                void* p = ::operator new(sizeof(shared_text_rep) + (len + 1) * sizeof(T));
+                shared_text_rep* rep = new (p) shared_text_rep(len);
+                rep->data()[len] = T();
+                return rep;
+            }
+            void add_ref() { refs.fetch_add(1, std::memory_order_relaxed); }
+            void release() {
+                if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    this->~shared_text_rep();
+                    ::operator delete(this);
+                }
+            }
+
+            template <typename E, typename EDest>
+            struct convert_op {
+                shared_text_rep* rep;
+                void operator()() const {
+                    typedef typename utf_traits<EDest>::codeunit_type unit_type;
+                    stringview<const T*, E> src(rep->data(), rep->data() + rep->len);
+                    const int id = encoding_id<EDest>::value;
+                    size_t n = src.template codeunits<EDest>();
+                    unit_type* dest = static_cast<unit_type*>(::operator new((n + 1) * sizeof(unit_type)));
+                    *src.template to<EDest>(dest) = 0;
+                    rep->alt_len[id] = n;
+                    rep->alts[id].store(dest, std::memory_order_release);
+                }
+            };
+        };
+    }
+
+    // An immutable, reference counted string of E-encoded code units, for
+    // text which is handed to many threads. Copies share the data, and are
+    // safe to use from different threads at the same time.
+    //
+    // Besides the facts cached by basic_text, the text can be viewed in the
+    // other encodings. Each conversion is done on first use, once, no matter
+    // how many threads ask for it at the same time, and is shared by all
+    // copies.
+    template <typename E>
+    class basic_shared_text {
+    public:
+        typedef E encoding;
+        typedef typename internal::utf_traits<E>::codeunit_type value_type;
+        typedef const value_type* const_iterator;
+        typedef const value_type* iterator;
+
+        basic_shared_text() : rep(0) {}
+
+        // copy code units which are already E-encoded
+        basic_shared_text(const value_type* first, const value_type* last) : rep(rep_type::create(last - first)) {
+            std::copy(first, last, rep->data());
+        }
+
+        // transcode sv from whichever encoding it is in
+        template <typename Iter, typename ESrc>
+        explicit basic_shared_text(const stringview<Iter, ESrc>& sv) : rep(rep_type::create(sv.template codeunits<E>())) {
+            sv.template to<E>(rep->data());
+        }
+
+        basic_shared_text(const basic_shared_text& other) : rep(other.rep) {
+            if (rep) { rep->add_ref(); }
+        }
+        basic_shared_text(basic_shared_text&& other) noexcept : rep(other.rep) { other.rep = 0; }
+        ~basic_shared_text() {
+            if (rep) { rep->release(); }
+        }
+
+        basic_shared_text& operator = (basic_shared_text other) {
+            swap(other);
+            return *this;
+        }
+        void swap(basic_shared_text& other) { std::swap(rep, other.rep); }
+
+        const value_type* data() const { return rep ? rep->data() : empty_data(); }
+        const value_type* c_str() const { return data(); }
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + size(); }
+
+        bool empty() const { return size() == 0; }
+        size_t size() const { return rep ? rep->len : 0; }
+        size_t codeunits() const { return size(); }
+        size_t bytes() const { return size() * sizeof(value_type); }
+        // number of basic_shared_text objects sharing the data
+        size_t use_count() const { return rep ? rep->refs.load(std::memory_order_relaxed) : 0; }
+
+        stringview<const value_type*, E> view() const { return stringview<const value_type*, E>(begin(), end()); }
+
+        // the text in EDest, null-terminated, and valid for as long as any
+        // copy of this object is alive
+        template <typename EDest>
+        stringview<const typename internal::utf_traits<EDest>::codeunit_type*, EDest> view_as() const {
+            typedef typename internal::utf_traits<EDest>::codeunit_type unit_type;
+            typedef stringview<const unit_type*, EDest> view_type;
+            if (internal::encoding_id<EDest>::value == internal::encoding_id<E>::value) {
+                const unit_type* p = reinterpret_cast<const unit_type*>(data());
+                return view_type(p, p + size());
+            }
+            if (!rep) {
+                const unit_type* p = reinterpret_cast<const unit_type*>(empty_data());
+                return view_type(p, p);
+            }
+            const int id = internal::encoding_id<EDest>::value;
+            void* p = rep->alts[id].load(std::memory_order_acquire);
+            if (!p) {
+                typename rep_type::template convert_op<E, EDest> op = { rep };
+                std::call_once(rep->once[id], op);
+                p = rep->alts[id].load(std::memory_order_acquire);
+            }
+            const unit_type* units = static_cast<const unit_type*>(p);
+            return view_type(units, units + rep->alt_len[id]);
+        }
+
+        bool validate() const { return rep ? rep->meta.template validate<E>(begin(), end()) : true; }
+        bool is_ascii() const { return rep ? rep->meta.is_ascii(begin(), end()) : true; }
+        size_t codepoints() const { return rep ? rep->meta.template codepoints<E>(begin(), end()) : 0; }
+
+        friend bool operator == (const basic_shared_text& lhs, const basic_shared_text& rhs) { return lhs.rep == rhs.rep || equal(lhs.view(), rhs.view()); }
+        friend bool operator != (const basic_shared_text& lhs, const basic_shared_text& rhs) { return !(lhs == rhs); }
+        // code point order
+        friend bool operator < (const basic_shared_text& lhs, const basic_shared_text& rhs) { return compare(lhs.view(), rhs.view()) < 0; }
+
+    private:
+        typedef internal::shared_text_rep<value_type> rep_type;
+
+        static const value_type* empty_data() {
+            static const value_type terminator = value_type();
+            return &terminator;
+        }
+
+        rep_type* rep;
+    };
+
+    typedef basic_shared_text<utf8> shared_text8;
+    typedef basic_shared_text<utf16> shared_text16;
+    typedef basic_shared_text<utf32> shared_text32;
+
+    // Monotonic bump allocator for short-lived data, such as the strings
+    // converted while handling a single request. Individual allocations
+    // are never freed; reset() discards them all at once. It goes back to
+    // the caller's buffer, if there is one, but keeps the most recently
+    // allocated block, so a reused arena stops allocating once it has grown
+    // to fit the workload.
+    //
+    // With C++17 it is a std::pmr::memory_resource, so standard containers
+    // can allocate from it. allocate is also callable directly, without
+    // the virtual call, which is what to_arena does.
+    class arena
+#ifdef __cpp_lib_memory_resource
+    : public std::pmr::memory_resource
+#endif
+    {
+        struct block {
+            block* next;
+            size_t size;
+        };
+
+    public:
+        explicit arena(size_t block_size = 4096) : head(0), spare(0), pos(0), end(0), initial(0), initial_end(0), block_size(block_size) {}
+        // serve allocations from buf until it runs out. buf is not owned
+        arena(void* buf, size_t size, size_t block_size = 4096)
+        : head(0), spare(0), pos(static_cast<char*>(buf)), end(pos + size), initial(pos), initial_end(end), block_size(block_size) {}
+
+        ~arena() {
+            free_blocks(head);
+            free_blocks(spare);
+        }
+
+        void* allocate(size_t bytes, size_t alignment = sizeof(void*)) {
+            char* p = align(pos, alignment);
+            // aligning can move p past the end of a nearly full block
+            if (!p || p > end || static_cast<size_t>(end - p) < bytes) {
+                grow(bytes + alignment);
+                p = align(pos, alignment);
+            }
+            pos = p + bytes;
+            return p;
+        }
+
+        void reset() {
+            if (head) {
+                free_blocks(head->next);
+                head->next = 0;
+            }
+            if (initial) {
+                // the kept block is used again once the buffer runs out
+                spare = head;
+                head = 0;
+                pos = initial;
+                end = initial_end;
+            }
+            else if (head) {
+                pos = reinterpret_cast<char*>(head + 1);
+                end = pos + head->size;
+            }
+        }
+
+    private:
+        arena(const arena&);
+        arena& operator = (const arena&);
+
+#ifdef __cpp_lib_memory_resource
+        void* do_allocate(size_t bytes, size_t alignment) override { return allocate(bytes, alignment); }
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+#endif
+
+        static char* align(char* p, size_t alignment) {
+            if (!p) { return 0; }
+            uintptr_t v = reinterpret_cast<uintptr_t>(p);
+            return p + ((alignment - v % alignment) % alignment);
+        }
+
+        void grow(size_t min_size) {
+            block* b = spare;
+            spare = 0;
+            if (b && b->size < min_size) {
+                free_blocks(b);
+                b = 0;
+            }
+            if (!b) {
+                size_t size = block_size;
+                while (size < min_size) { size *= 2; }
+                b = static_cast<block*>(::operator new(sizeof(block) + size));
+                b->size = size;
+                // grow geometrically so a busy arena needs few blocks
+                block_size = size * 2;
+            }
+            b->next = head;
+            head = b;
+            pos = reinterpret_cast<char*>(b + 1);
+            end = pos + b->size;
+        }
+
+        static void free_blocks(block* b) {
+            while (b) {
+                block* next = b->next;
+                ::operator delete(b);
+                b = next;
+            }
+        }
+
+        block* head;
+        block* spare; // kept by reset() while the initial buffer is in use
+        char* pos;
+        char* end;
+        char* initial;
+        char* initial_end;
+        size_t block_size;
+    };
+
+    // Transcode sv to EDest into exactly sized memory from a, which can be
+    // a utf::arena, a std::pmr::memory_resource, or anything else with an
+    // allocate(bytes, alignment) member. Returns a view of the result, which
+    // lives as long as the arena's memory does. Empty input takes no memory.
+    template <typename EDest, typename Iter, typename E, typename Arena>
+    stringview<const typename internal::utf_traits<EDest>::codeunit_type*, EDest> to_arena(const stringview<Iter, E>& sv, Arena& a) {
+        typedef typename internal::utf_traits<EDest>::codeunit_type unit_type;
+        size_t n = sv.template codeunits<EDest>();
+        if (n == 0) { return stringview<const unit_type*, EDest>(nullptr, nullptr); }
+        unit_type* p = static_cast<unit_type*>(a.allocate(n * sizeof(unit_type), sizeof(unit_type)));
+        sv.template to<EDest>(p);
+        return stringview<const unit_type*, EDest>(p, p + n);
+    }
+
+    namespace internal {
+        // results up to this size are converted on the stack
+        static const size_t scratch_stack_bytes = 1024;
+
+        // a per-thread buffer which only ever grows, so converting strings
+        // of a similar size over and over stops allocating
+        template <typename T>
+        struct scratch_buffer {
+            std::vector<T> units;
+            bool busy;
+
+            static scratch_buffer& get() {
+                static thread_local scratch_buffer buf = { std::vector<T>(), false };
+                return buf;
+            }
+        };
+
+        template <typename T>
+        struct scratch_guard {
+            scratch_buffer<T>& buf;
+            explicit scratch_guard(scratch_buffer<T>& buf) : buf(buf) { buf.busy = true; }
+            ~scratch_guard() { buf.busy = false; }
+        };
+    }
+
+    // Transcode sv to EDest into temporary storage and call f with a
+    // stringview of the result, returning whatever f returns. The view is
+    // followed by a null code unit, and is only valid until f returns.
+    //
+    // Small results are converted into a buffer on the stack, larger ones
+    // into a thread-local buffer which is reused by later calls. If f
+    // itself calls with_converted with a large string, the inner call
+    // falls back to a heap allocation instead of clobbering the outer one.
+    template <typename EDest, typename Iter, typename E, typename F>
+    auto with_converted(const stringview<Iter, E>& sv, F f)
+    -> decltype(f(std::declval<stringview<const typename internal::utf_traits<EDest>::codeunit_type*, EDest> >())) {
+        typedef typename internal::utf_traits<EDest>::codeunit_type unit_type;
+        typedef stringview<const unit_type*, EDest> view_type;
+        const size_t stack_units = internal::scratch_stack_bytes / sizeof(unit_type);
+
+        size_t n = sv.template codeunits<EDest>();
+        if (n < stack_units) {
+            unit_type buf[stack_units];
+            *sv.template to<EDest>(buf) = 0;
+            return f(view_type(buf, buf + n));
+        }
+
+        internal::scratch_buffer<unit_type>& scratch = internal::scratch_buffer<unit_type>::get();
+        if (scratch.busy) {
+            std::vector<unit_type> buf(n + 1);
+            *sv.template to<EDest>(buf.data()) = 0;
+            return f(view_type(buf.data(), buf.data() + n));
+        }
+        internal::scratch_guard<unit_type> guard(scratch);
+        if (scratch.units.size() < n + 1) { scratch.units.resize(n + 1); }
+        unit_type* p = scratch.units.data();
+        *sv.template to<EDest>(p) = 0;
+        return f(view_type(p, p + n));
+    }
+}
+
+#endif
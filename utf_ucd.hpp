@@ -0,0 +1,3468 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Unicode 14.0.0 character properties. Requires C++11.
+//
+// Generated by tools/gen_ucd.py. Do not edit.
+
+#ifndef NP_UTF_UCD_HPP
+#define NP_UTF_UCD_HPP
+
+#include "utf.hpp"
+
+namespace utf {
+    inline const char* ucd_version() { return "14.0.0"; }
+
+    enum general_category {
+        gc_cn,
+        gc_lu,
+        gc_ll,
+        gc_lt,
+        gc_lm,
+        gc_lo,
+        gc_mn,
+        gc_mc,
+        gc_me,
+        gc_nd,
+        gc_nl,
+        gc_no,
+        gc_pc,
+        gc_pd,
+        gc_ps,
+        gc_pe,
+        gc_pi,
+        gc_pf,
+        gc_po,
+        gc_sm,
+        gc_sc,
+        gc_sk,
+        gc_so,
+        gc_zs,
+        gc_zl,
+        gc_zp,
+        gc_cc,
+        gc_cf,
+        gc_cs,
+        gc_co,
+    };
+
+    enum script {
+        sc_unknown,
+        sc_common,
+        sc_inherited,
+        sc_adlam,
+        sc_ahom,
+        sc_anatolian_hieroglyphs,
+        sc_arabic,
+        sc_armenian,
+        sc_avestan,
+        sc_balinese,
+        sc_bamum,
+        sc_bassa_vah,
+        sc_batak,
+        sc_bengali,
+        sc_bhaiksuki,
+        sc_bopomofo,
+        sc_brahmi,
+        sc_braille,
+        sc_buginese,
+        sc_buhid,
+        sc_canadian_aboriginal,
+        sc_carian,
+        sc_caucasian_albanian,
+        sc_chakma,
+        sc_cham,
+        sc_cherokee,
+        sc_chorasmian,
+        sc_coptic,
+        sc_cuneiform,
+        sc_cypriot,
+        sc_cypro_minoan,
+        sc_cyrillic,
+        sc_deseret,
+        sc_devanagari,
+        sc_dives_akuru,
+        sc_dogra,
+        sc_duployan,
+        sc_egyptian_hieroglyphs,
+        sc_elbasan,
+        sc_elymaic,
+        sc_ethiopic,
+        sc_georgian,
+        sc_glagolitic,
+        sc_gothic,
+        sc_grantha,
+        sc_greek,
+        sc_gujarati,
+        sc_gunjala_gondi,
+        sc_gurmukhi,
+        sc_han,
+        sc_hangul,
+        sc_hanifi_rohingya,
+        sc_hanunoo,
+        sc_hatran,
+        sc_hebrew,
+        sc_hiragana,
+        sc_imperial_aramaic,
+        sc_inscriptional_pahlavi,
+        sc_inscriptional_parthian,
+        sc_javanese,
+        sc_kaithi,
+        sc_kannada,
+        sc_katakana,
+        sc_kayah_li,
+        sc_kharoshthi,
+        sc_khitan_small_script,
+        sc_khmer,
+        sc_khojki,
+        sc_khudawadi,
+        sc_lao,
+        sc_latin,
+        sc_lepcha,
+        sc_limbu,
+        sc_linear_a,
+        sc_linear_b,
+        sc_lisu,
+        sc_lycian,
+        sc_lydian,
+        sc_mahajani,
+        sc_makasar,
+        sc_malayalam,
+        sc_mandaic,
+        sc_manichaean,
+        sc_marchen,
+        sc_masaram_gondi,
+        sc_medefaidrin,
+        sc_meetei_mayek,
+        sc_mende_kikakui,
+        sc_meroitic_cursive,
+        sc_meroitic_hieroglyphs,
+        sc_miao,
+        sc_modi,
+        sc_mongolian,
+        sc_mro,
+        sc_multani,
+        sc_myanmar,
+        sc_nabataean,
+        sc_nandinagari,
+        sc_new_tai_lue,
+        sc_newa,
+        sc_nko,
+        sc_nushu,
+        sc_nyiakeng_puachue_hmong,
+        sc_ogham,
+        sc_ol_chiki,
+        sc_old_hungarian,
+        sc_old_italic,
+        sc_old_north_arabian,
+        sc_old_permic,
+        sc_old_persian,
+        sc_old_sogdian,
+        sc_old_south_arabian,
+        sc_old_turkic,
+        sc_old_uyghur,
+        sc_oriya,
+        sc_osage,
+        sc_osmanya,
+        sc_pahawh_hmong,
+        sc_palmyrene,
+        sc_pau_cin_hau,
+        sc_phags_pa,
+        sc_phoenician,
+        sc_psalter_pahlavi,
+        sc_rejang,
+        sc_runic,
+        sc_samaritan,
+        sc_saurashtra,
+        sc_sharada,
+        sc_shavian,
+        sc_siddham,
+        sc_signwriting,
+        sc_sinhala,
+        sc_sogdian,
+        sc_sora_sompeng,
+        sc_soyombo,
+        sc_sundanese,
+        sc_syloti_nagri,
+        sc_syriac,
+        sc_tagalog,
+        sc_tagbanwa,
+        sc_tai_le,
+        sc_tai_tham,
+        sc_tai_viet,
+        sc_takri,
+        sc_tamil,
+        sc_tangsa,
+        sc_tangut,
+        sc_telugu,
+        sc_thaana,
+        sc_thai,
+        sc_tibetan,
+        sc_tifinagh,
+        sc_tirhuta,
+        sc_toto,
+        sc_ugaritic,
+        sc_vai,
+        sc_vithkuqi,
+        sc_wancho,
+        sc_warang_citi,
+        sc_yezidi,
+        sc_yi,
+        sc_zanabazar_square,
+    };
+
+    enum east_asian_width {
+        eaw_neutral,
+        eaw_ambiguous,
+        eaw_halfwidth,
+        eaw_wide,
+        eaw_fullwidth,
+        eaw_narrow,
+    };
+
+    enum binary_property {
+        prop_white_space = 1,
+        prop_uppercase = 2,
+        prop_lowercase = 4,
+        prop_xid_start = 8,
+        prop_xid_continue = 16,
+        prop_default_ignorable = 32,
+        prop_extended_pictographic = 64,
+    };
+
+    enum grapheme_break {
+        gcb_other,
+        gcb_cr,
+        gcb_lf,
+        gcb_control,
+        gcb_extend,
+        gcb_zwj,
+        gcb_regional_indicator,
+        gcb_prepend,
+        gcb_spacing_mark,
+        gcb_l,
+        gcb_v,
+        gcb_t,
+        gcb_lv,
+        gcb_lvt,
+        gcb_extended_pictographic,
+    };
+
+    enum case_mapping {
+        cm_lower,
+        cm_upper,
+        cm_fold,
+    };
+
+    namespace internal {
+        // a class template, so the tables can be defined in a header
+        template <typename T>
+        struct ucd_tables {
+            static constexpr uint8_t general_category_stage1[2176] = {
+                0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,
+                24,25,26,26,26,26,26,26,26,26,26,26,26,26,27,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,28,26,29,30,31,32,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,33,34,34,34,34,35,35,35,35,35,35,35,35,
+                35,35,35,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,
+                26,56,57,58,58,58,58,59,26,26,60,58,58,58,58,58,58,58,26,61,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,26,62,58,63,26,26,26,26,26,26,26,26,
+                26,26,26,64,26,26,65,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,66,
+                67,68,58,58,58,58,69,58,58,58,58,58,58,58,58,70,71,72,73,74,75,76,58,77,
+                78,79,58,80,81,58,82,83,84,85,75,86,87,88,58,58,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,89,26,26,26,26,26,26,26,90,91,26,26,26,26,26,26,26,26,26,26,92,
+                26,26,26,26,26,26,26,26,26,26,26,26,26,93,58,58,58,58,58,58,26,94,58,58,
+                26,26,26,26,26,26,26,26,26,95,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,96,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,97,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,97,
+            };
+            static constexpr uint16_t general_category_stage2[3136] = {
+                0,0,1,2,3,4,5,6,0,0,7,8,9,10,11,12,13,13,13,14,15,13,13,16,
+                17,18,19,20,21,22,13,23,13,13,13,24,25,11,11,11,11,26,11,27,28,29,30,31,
+                32,32,32,32,32,32,32,33,34,35,36,11,37,38,13,39,9,9,9,11,11,11,13,13,
+                40,13,13,13,41,13,13,13,13,13,13,42,9,43,11,11,44,45,32,46,47,48,49,50,
+                51,52,48,48,53,32,54,55,48,48,48,48,48,56,57,58,59,60,48,32,61,48,48,48,
+                48,48,62,63,64,48,65,66,48,67,68,69,48,70,71,48,72,73,48,48,74,32,75,32,
+                76,48,48,77,78,79,80,81,82,83,84,85,86,87,88,89,90,83,84,91,92,93,94,95,
+                96,97,84,98,99,100,88,101,102,83,84,103,104,105,88,106,107,108,109,110,111,112,94,113,
+                114,115,84,116,117,118,88,119,120,115,84,121,122,123,88,124,125,115,48,126,127,128,88,129,
+                130,131,48,132,133,134,94,135,136,48,48,137,138,139,140,140,141,48,142,143,144,145,140,140,
+                146,147,148,149,150,48,151,152,153,154,32,155,156,157,140,140,48,48,158,159,160,161,162,163,
+                164,165,9,9,166,11,11,167,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,168,169,48,48,168,48,48,170,171,172,48,48,48,171,48,48,48,173,174,175,
+                48,176,9,9,9,9,9,177,178,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,179,48,
+                180,181,48,48,48,48,182,183,48,184,48,185,48,186,187,188,48,48,48,189,190,191,192,193,
+                194,192,48,48,195,48,48,196,197,48,198,48,48,48,48,199,48,200,201,202,203,48,204,205,
+                48,48,206,48,207,208,209,209,48,210,48,48,48,211,212,213,192,192,214,215,216,140,140,140,
+                217,48,48,218,219,160,220,221,222,48,223,64,48,48,224,225,48,48,226,227,228,64,48,229,
+                230,9,9,231,232,233,234,235,11,11,236,27,27,27,237,238,11,239,27,27,32,32,32,32,
+                13,13,13,13,13,13,13,13,13,240,13,13,13,13,13,13,241,242,241,241,242,243,241,244,
+                245,245,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,261,262,263,264,265,
+                266,267,268,269,270,271,272,272,273,274,275,209,276,277,209,278,279,279,279,279,279,279,279,279,
+                279,279,279,279,279,279,279,279,280,209,281,209,209,209,209,282,209,283,279,284,209,285,286,209,
+                209,209,287,140,288,140,271,271,271,289,209,209,209,209,290,271,209,209,209,209,209,209,209,209,
+                209,209,209,291,292,209,209,293,209,209,209,209,209,209,294,209,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,209,295,296,271,297,209,209,298,279,299,279,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,209,209,209,279,279,279,279,279,279,279,279,300,301,279,279,279,302,279,303,
+                279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,279,209,209,209,279,304,209,209,305,
+                209,306,209,209,209,209,209,209,9,9,9,11,11,11,307,308,13,13,13,13,13,13,309,310,
+                11,11,311,48,48,48,312,313,48,314,315,315,315,315,32,32,316,317,318,319,320,321,140,140,
+                209,322,209,209,209,209,209,323,209,209,209,209,209,209,209,209,209,209,209,209,209,324,140,325,
+                326,327,328,329,136,48,48,48,48,330,178,48,48,48,48,331,332,48,48,136,48,48,48,48,
+                200,333,48,48,209,209,323,48,209,334,335,209,336,337,209,209,335,209,209,337,209,209,209,209,
+                209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,209,209,209,209,48,338,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                151,209,209,209,287,48,48,229,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                339,48,340,140,13,13,341,342,13,343,48,48,48,48,344,345,31,346,347,348,13,13,13,349,
+                350,351,352,353,354,355,140,356,357,48,358,359,48,48,48,360,361,48,48,362,363,192,32,364,
+                64,48,365,48,366,367,48,151,76,48,48,368,369,370,371,372,48,48,373,374,375,376,48,377,
+                48,48,48,378,379,380,381,382,383,384,315,11,11,385,386,11,11,11,11,11,48,48,387,192,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,388,48,389,48,48,206,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,
+                390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,390,391,391,391,391,391,391,391,391,
+                391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+                391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,204,48,48,48,48,48,48,207,140,140,
+                392,393,394,395,396,48,48,48,48,48,48,397,398,399,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,400,209,48,48,48,48,401,48,48,402,140,140,403,
+                32,404,32,405,406,407,408,409,48,48,48,48,48,48,48,410,411,2,3,4,5,412,413,414,
+                48,415,48,200,416,417,418,419,420,48,172,421,204,204,140,140,48,48,48,48,48,48,48,71,
+                422,271,271,423,272,272,272,424,425,426,427,140,140,209,209,428,140,140,140,140,140,140,140,140,
+                48,151,48,48,48,100,429,430,48,48,431,48,432,48,48,433,48,434,48,48,435,436,140,140,
+                9,9,437,11,11,48,48,48,48,204,192,9,9,438,11,439,48,48,440,48,48,48,441,442,
+                442,443,444,445,140,140,140,140,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,314,48,199,440,140,446,27,27,447,140,140,140,140,448,48,48,449,48,450,48,451,
+                48,200,452,140,140,140,48,453,48,454,48,455,140,140,140,140,48,48,48,456,271,457,271,271,
+                458,459,48,460,461,462,48,463,48,464,140,140,465,48,466,467,48,48,48,468,48,469,48,470,
+                48,471,472,140,140,140,140,140,48,48,48,48,196,140,140,140,9,9,9,473,11,11,11,474,
+                48,48,475,192,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,271,476,
+                48,48,477,478,140,140,140,140,48,464,479,48,62,480,140,48,481,140,140,48,482,140,48,314,
+                483,48,48,484,485,457,486,487,222,48,48,488,489,48,196,192,490,48,491,492,493,48,48,494,
+                222,48,48,495,496,497,498,499,48,97,500,501,140,140,140,140,502,503,504,48,48,505,506,192,
+                507,83,84,508,509,510,511,512,140,140,140,140,140,140,140,140,48,48,48,513,514,515,478,140,
+                48,48,48,516,517,192,140,140,140,140,140,140,140,140,140,140,48,48,518,519,520,521,140,140,
+                48,48,48,522,523,192,524,140,48,48,525,526,192,140,140,140,48,173,527,528,314,140,140,140,
+                140,140,140,140,140,140,140,140,48,48,500,529,140,140,140,140,140,140,9,9,11,11,148,530,
+                531,532,48,533,534,192,140,140,140,140,535,48,48,536,537,140,538,48,48,539,540,541,48,48,
+                542,543,544,48,48,48,48,196,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                84,48,518,545,546,148,175,547,48,548,549,550,140,140,140,140,551,48,48,552,553,192,554,48,
+                555,556,192,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,557,
+                140,140,140,140,140,140,140,140,140,140,140,100,271,558,559,560,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,207,140,140,140,140,140,140,
+                272,272,272,272,272,272,561,562,48,48,48,48,48,48,48,48,48,48,48,48,388,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,48,48,48,48,563,
+                48,48,200,564,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,48,48,48,48,314,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,48,196,48,200,370,48,
+                48,48,48,200,192,48,204,565,48,48,48,566,567,568,569,570,48,140,140,140,140,140,140,140,
+                140,140,140,140,9,9,11,11,271,571,140,140,140,140,140,140,48,48,48,48,572,573,574,574,
+                575,576,140,140,140,140,577,578,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,440,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,199,140,140,196,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,579,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,580,140,140,580,581,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,206,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                48,48,48,48,48,48,71,151,196,582,583,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                32,32,584,32,585,209,209,209,209,209,209,209,323,140,140,140,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,209,209,324,209,209,586,209,209,209,587,588,589,209,590,209,209,209,288,140,
+                209,209,209,209,591,140,140,140,140,140,140,140,140,140,271,592,209,209,209,209,209,287,271,461,
+                140,140,140,140,140,140,140,140,9,593,11,594,595,596,241,9,597,598,599,600,601,9,593,11,
+                602,603,11,604,605,606,607,9,608,11,9,593,11,594,595,11,241,9,597,607,9,608,11,9,
+                593,11,609,9,610,611,612,613,11,614,9,615,616,617,618,11,619,9,620,11,621,622,622,622,
+                209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,209,209,209,32,32,32,623,32,32,624,625,626,627,45,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,628,629,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                630,631,632,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,151,633,634,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,635,140,48,48,636,637,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,638,200,
+                48,48,48,48,48,48,48,48,48,48,48,48,639,585,140,140,9,9,597,11,640,370,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,498,271,271,641,642,140,140,140,140,
+                498,271,643,644,140,140,140,140,140,140,140,140,140,140,140,140,645,48,646,647,648,649,650,651,
+                652,206,653,206,140,140,140,654,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                209,209,325,209,209,209,209,209,209,323,334,655,655,655,209,324,656,209,209,209,209,209,209,209,
+                209,209,657,140,140,140,658,209,659,209,209,325,660,661,324,140,140,140,140,140,140,140,140,140,
+                209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,662,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,663,426,426,209,209,209,209,209,209,209,323,209,209,209,209,209,660,325,427,
+                325,209,209,209,664,176,209,209,664,209,657,661,140,140,140,140,209,209,209,209,209,209,209,209,
+                209,209,209,209,209,209,209,209,209,209,209,209,209,323,657,665,287,209,426,288,324,176,664,287,
+                209,209,209,209,209,209,209,209,209,666,209,209,288,140,140,192,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,140,140,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,196,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,204,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,478,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,100,140,48,204,140,140,140,140,140,140,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,48,48,48,48,48,71,140,140,140,140,140,140,140,140,140,140,140,
+                667,140,668,668,668,668,668,668,140,140,140,140,140,140,140,140,32,32,32,32,32,32,32,32,
+                32,32,32,32,32,32,32,140,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,
+                391,391,391,391,391,391,391,391,391,391,391,391,391,391,391,669,
+            };
+            static constexpr uint8_t general_category_stage3[10720] = {
+                26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,23,18,18,18,20,18,18,18,
+                14,15,18,19,18,13,18,18,9,9,9,9,9,9,9,9,9,9,18,18,19,19,19,18,
+                18,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,14,18,15,21,12,21,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,14,19,15,19,26,23,18,20,20,20,20,22,18,
+                21,22,5,16,19,27,22,21,22,19,11,11,21,2,18,18,21,11,5,17,11,11,11,18,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,19,
+                1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,19,2,2,2,2,2,2,2,2,1,2,1,2,1,2,1,2,
+                1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,
+                2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+                1,1,2,1,2,1,2,2,2,1,1,2,1,2,1,1,2,1,1,1,2,2,1,1,
+                1,1,2,1,1,2,1,1,1,2,2,2,1,1,2,1,1,2,1,2,1,2,1,1,
+                2,1,2,2,1,2,1,1,2,1,1,1,2,1,2,1,1,2,2,5,1,2,2,2,
+                5,5,5,5,1,3,2,1,3,2,1,3,2,1,2,1,2,1,2,1,2,1,2,1,
+                2,1,2,1,2,2,1,2,2,1,3,2,1,2,1,1,1,2,1,2,1,2,1,2,
+                1,2,1,2,2,2,2,2,2,2,1,1,2,1,1,2,2,1,2,1,1,1,1,2,
+                1,2,1,2,1,2,1,2,2,2,2,2,5,2,2,2,2,2,2,2,2,2,2,2,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,21,21,21,21,4,4,
+                4,4,4,4,4,4,4,4,4,4,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                4,4,4,4,4,21,21,21,21,21,21,21,4,21,4,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                1,2,1,2,4,21,1,2,0,0,4,2,2,2,18,1,0,0,0,0,21,21,1,18,
+                1,1,1,0,1,0,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,1,2,2,1,1,1,2,2,2,1,2,1,2,1,2,1,2,
+                2,2,2,2,1,2,19,1,2,1,1,2,2,1,1,1,1,2,22,6,6,6,6,6,
+                8,8,1,2,1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,
+                0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+                0,4,18,18,18,18,18,18,2,2,2,2,2,2,2,2,2,18,13,0,0,22,22,20,
+                0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                6,6,6,6,6,6,13,6,18,6,6,18,6,6,18,6,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,0,0,0,0,5,5,5,5,18,18,0,0,0,0,0,0,0,0,0,0,0,
+                27,27,27,27,27,27,19,19,19,18,18,20,18,18,22,22,6,6,6,6,6,6,6,6,
+                6,6,6,18,27,18,18,18,4,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+                9,9,9,9,9,9,9,9,9,9,18,18,18,18,5,5,6,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,18,5,6,6,6,6,6,6,6,27,22,6,
+                6,6,6,6,6,4,4,6,6,22,6,6,6,6,5,5,9,9,9,9,9,9,9,9,
+                9,9,5,5,5,22,22,5,18,18,18,18,18,18,18,18,18,18,18,18,18,18,0,27,
+                5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,
+                6,6,6,0,0,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,
+                6,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,9,
+                9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+                6,6,6,6,4,4,22,18,18,18,4,0,0,6,20,20,5,5,5,5,5,5,6,6,
+                6,6,4,6,6,6,6,6,6,6,6,6,4,6,6,6,4,6,6,6,6,6,0,0,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,0,5,5,5,5,5,5,5,5,
+                5,6,6,6,0,0,18,0,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+                5,5,5,5,5,5,5,5,21,5,5,5,5,5,5,0,27,27,0,0,0,0,0,0,
+                6,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,5,4,6,6,6,6,6,6,
+                6,6,27,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,7,6,5,7,7,
+                7,6,6,6,6,6,6,6,6,7,7,7,7,6,7,7,5,6,6,6,6,6,6,6,
+                5,5,5,5,5,5,5,5,5,5,6,6,18,18,9,9,9,9,9,9,9,9,9,9,
+                18,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,7,7,0,5,5,5,
+                5,5,5,5,5,0,0,5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,0,0,0,5,5,
+                5,5,0,0,6,5,7,7,7,6,6,6,6,0,0,7,7,0,0,7,7,6,5,0,
+                0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,5,5,5,6,6,0,0,9,9,
+                9,9,9,9,9,9,9,9,5,5,20,20,11,11,11,11,11,11,22,20,5,18,6,0,
+                0,6,6,7,0,5,5,5,5,5,5,0,0,0,0,5,5,0,5,5,0,5,5,0,
+                5,5,0,0,6,0,7,7,7,6,6,0,0,0,0,6,6,0,0,6,6,6,0,0,
+                0,6,0,0,0,0,0,0,0,5,5,5,5,0,5,0,0,0,0,0,0,0,9,9,
+                9,9,9,9,9,9,9,9,6,6,5,5,5,6,18,0,0,0,0,0,0,0,0,0,
+                0,6,6,7,0,5,5,5,5,5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,0,5,5,0,5,5,5,5,5,0,0,6,5,7,7,
+                7,6,6,6,6,6,0,6,6,7,0,7,7,6,0,0,5,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,18,20,0,0,0,0,0,0,0,5,6,6,6,6,6,6,
+                0,6,7,7,0,5,5,5,5,5,5,5,5,0,0,5,5,0,5,5,0,5,5,5,
+                5,5,0,0,6,5,7,6,7,6,6,6,6,0,0,7,7,0,0,7,7,6,0,0,
+                0,0,0,0,0,6,6,7,0,0,0,0,5,5,0,5,22,5,11,11,11,11,11,11,
+                0,0,0,0,0,0,0,0,0,0,6,5,0,5,5,5,5,5,5,0,0,0,5,5,
+                5,0,5,5,5,5,0,0,0,5,5,0,5,0,5,5,0,0,0,5,5,0,0,0,
+                5,5,5,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,7,7,
+                6,7,7,0,0,0,7,7,7,0,7,7,7,6,0,0,5,0,0,0,0,0,0,7,
+                0,0,0,0,0,0,0,0,11,11,11,22,22,22,22,22,22,20,22,0,0,0,0,0,
+                6,7,7,7,6,5,5,5,5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,6,5,6,6,
+                6,7,7,7,7,0,6,6,6,0,6,6,6,6,0,0,0,0,0,0,0,6,6,0,
+                5,5,5,0,0,5,0,0,0,0,0,0,0,0,0,18,11,11,11,11,11,11,11,22,
+                5,6,7,7,18,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,0,5,5,5,
+                5,5,0,0,6,5,7,6,7,7,7,7,7,0,6,7,7,0,7,7,6,6,0,0,
+                0,0,0,0,0,7,7,0,0,0,0,0,0,5,5,0,0,5,5,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,6,6,7,7,5,5,5,5,5,5,5,5,5,0,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,6,6,5,7,7,7,6,6,6,6,0,7,7,
+                7,0,7,7,7,6,5,22,0,0,0,0,5,5,5,7,11,11,11,11,11,11,11,5,
+                11,11,11,11,11,11,11,11,11,22,5,5,5,5,5,5,0,6,7,7,0,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,5,5,5,5,5,5,
+                5,5,0,5,5,5,5,5,5,5,5,5,0,5,0,0,5,5,5,5,5,5,5,0,
+                0,0,6,0,0,0,0,7,7,7,6,6,6,0,6,0,7,7,7,7,7,7,7,7,
+                0,0,7,7,18,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,6,0,0,0,0,20,
+                5,5,5,5,5,5,4,6,6,6,6,6,6,6,6,18,9,9,9,9,9,9,9,9,
+                9,9,18,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,5,5,0,5,0,5,5,5,5,5,0,5,5,5,5,5,5,5,5,0,5,0,5,
+                5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,6,6,6,5,0,0,
+                5,5,5,5,5,0,4,0,6,6,6,6,6,6,0,0,9,9,9,9,9,9,9,9,
+                9,9,0,0,5,5,5,5,5,22,22,22,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,22,18,22,22,22,6,6,22,22,22,22,22,22,9,9,9,9,9,9,9,9,
+                9,9,11,11,11,11,11,11,11,11,11,11,22,6,22,6,22,6,14,15,14,15,7,7,
+                5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,
+                6,6,6,6,6,18,6,6,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,
+                0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,22,22,
+                22,22,22,22,22,22,6,22,22,22,22,22,22,0,22,22,18,18,18,18,18,22,22,22,
+                22,18,18,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,7,7,6,6,6,
+                6,7,6,6,6,6,6,6,7,6,6,7,7,6,6,5,9,9,9,9,9,9,9,9,
+                9,9,18,18,18,18,18,18,5,5,5,5,5,5,7,7,6,6,5,5,5,5,6,6,
+                6,5,7,7,7,5,5,7,7,7,7,7,7,7,5,5,5,6,6,6,6,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,6,7,7,6,6,7,7,7,7,7,7,6,5,7,
+                9,9,9,9,9,9,9,9,9,9,7,7,7,6,22,22,1,1,1,1,1,1,0,1,
+                0,0,0,0,0,1,0,0,2,2,2,2,2,2,2,2,2,2,2,18,4,2,2,2,
+                5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,0,
+                5,0,5,5,5,5,0,0,5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,0,
+                5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,6,6,6,
+                18,18,18,18,18,18,18,18,18,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,0,0,0,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,
+                1,1,1,1,1,1,0,0,2,2,2,2,2,2,0,0,13,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,22,18,5,
+                23,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,14,15,0,0,0,5,5,5,5,5,5,5,5,5,5,5,18,18,18,10,10,
+                10,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,5,5,6,6,6,7,0,0,
+                0,0,0,0,0,0,0,5,5,5,6,6,7,18,18,0,0,0,0,0,0,0,0,0,
+                5,5,6,6,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,0,5,5,5,0,6,6,0,0,0,0,0,0,0,0,0,0,0,0,
+                5,5,5,5,6,6,7,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,6,7,
+                7,6,6,6,6,6,6,6,6,6,6,6,18,18,18,4,18,18,18,20,5,6,0,0,
+                9,9,9,9,9,9,9,9,9,9,0,0,0,0,0,0,11,11,11,11,11,11,11,11,
+                11,11,0,0,0,0,0,0,18,18,18,18,18,18,13,18,18,18,18,6,6,6,27,6,
+                5,5,5,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,0,0,0,0,0,0,0,5,5,5,5,5,6,6,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,6,5,0,0,0,0,0,5,5,5,5,5,5,0,0,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+                6,6,6,7,7,7,7,6,6,7,7,7,0,0,0,0,7,7,6,7,7,7,7,7,
+                7,6,6,6,0,0,0,0,22,0,0,0,18,18,9,9,9,9,9,9,9,9,9,9,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,5,5,5,5,5,0,0,0,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
+                5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,9,9,9,9,9,9,9,9,
+                9,9,11,0,0,0,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                5,5,5,5,5,5,5,6,6,7,7,6,0,0,18,18,5,5,5,5,5,7,6,7,
+                6,6,6,6,6,6,6,0,6,7,6,7,7,6,6,6,6,6,6,6,6,7,7,7,
+                7,7,7,6,6,6,6,6,6,6,6,6,6,0,0,6,18,18,18,18,18,18,18,4,
+                18,18,18,18,18,18,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,8,6,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,6,6,6,6,7,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,6,7,6,6,6,6,6,7,6,7,7,7,
+                7,7,6,7,7,5,5,5,5,5,5,5,5,0,0,0,18,22,22,22,22,22,22,22,
+                22,22,22,6,6,6,6,6,6,6,6,6,22,22,22,22,22,22,22,22,22,18,18,0,
+                6,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,6,6,6,6,7,7,
+                6,6,7,6,6,6,5,5,5,5,5,5,5,5,6,7,6,6,7,7,7,6,7,6,
+                6,6,7,7,0,0,0,0,0,0,0,0,18,18,18,18,5,5,5,5,7,7,7,7,
+                7,7,7,7,6,6,6,6,6,6,6,6,7,7,6,6,0,0,0,18,18,18,18,18,
+                9,9,9,9,9,9,9,9,9,9,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+                4,4,4,4,4,4,18,18,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,18,18,18,18,18,18,18,18,
+                0,0,0,0,0,0,0,0,6,6,6,18,6,6,6,6,6,6,6,6,6,6,6,6,
+                6,7,6,6,6,6,6,6,6,5,5,5,5,6,5,5,5,5,5,5,6,5,5,7,
+                6,6,5,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                4,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,4,
+                1,2,1,2,1,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,
+                1,1,1,1,1,1,1,1,2,2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,
+                2,2,2,2,2,2,2,2,0,1,0,1,0,1,0,1,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,
+                2,2,2,2,2,0,2,2,1,1,1,1,3,21,2,21,21,21,2,2,2,0,2,2,
+                1,1,1,1,3,21,21,21,2,2,2,2,0,0,2,2,1,1,1,1,0,21,21,21,
+                2,2,2,2,2,2,2,2,1,1,1,1,1,21,21,21,0,0,2,2,2,0,2,2,
+                1,1,1,1,3,21,21,0,23,23,23,23,23,23,23,23,23,23,23,27,27,27,27,27,
+                13,13,13,13,13,13,18,18,16,17,14,16,16,17,14,16,18,18,18,18,18,18,18,18,
+                24,25,27,27,27,27,27,23,18,18,18,18,18,18,18,18,18,16,17,18,18,18,18,12,
+                12,18,18,18,19,14,15,18,18,18,18,18,18,18,18,18,18,18,19,18,12,18,18,18,
+                18,18,18,18,18,18,18,23,27,27,27,27,27,0,27,27,27,27,27,27,27,27,27,27,
+                11,4,0,0,11,11,11,11,11,11,19,19,19,14,15,4,11,11,11,11,11,11,11,11,
+                11,11,19,19,19,14,15,0,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,
+                20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,8,8,8,
+                8,6,8,8,8,6,6,6,6,6,6,6,6,6,6,6,6,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,22,22,1,22,22,22,22,1,22,22,2,1,1,1,2,2,
+                1,1,1,2,22,1,22,22,19,1,1,1,1,1,22,22,22,22,22,22,1,22,1,22,
+                1,22,1,1,1,1,22,2,1,1,1,1,2,5,5,5,5,2,22,22,2,2,1,1,
+                19,19,19,19,19,1,2,2,2,2,22,19,22,22,2,22,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,1,2,10,10,10,10,11,22,22,0,0,0,0,19,19,19,19,19,22,22,22,
+                22,22,19,19,22,22,22,22,19,22,22,19,22,22,19,22,22,22,22,22,22,22,19,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,19,19,22,22,19,22,19,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+                14,15,14,15,22,22,22,22,19,19,22,22,22,22,22,22,22,14,15,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,19,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,19,19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,
+                22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,11,11,11,11,11,11,11,11,
+                11,11,11,11,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,11,11,11,11,11,
+                22,22,22,22,22,22,22,19,22,22,22,22,22,22,22,22,22,19,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,19,19,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,19,22,22,22,22,22,22,22,22,
+                14,15,14,15,14,15,14,15,14,15,14,15,14,15,11,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,14,15,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,14,15,14,15,14,15,14,15,14,15,
+                19,19,19,14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,
+                15,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,14,15,14,15,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,14,15,19,19,19,19,19,19,19,22,22,19,
+                19,19,19,19,19,22,22,22,22,22,22,22,0,0,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,0,22,22,22,22,22,22,22,22,22,1,2,1,1,1,2,2,1,
+                2,1,2,1,2,1,1,1,1,2,1,2,2,1,2,2,2,2,2,2,4,4,1,1,
+                1,2,1,2,2,22,22,22,22,22,22,1,2,1,2,6,6,6,1,2,0,0,0,0,
+                0,18,18,18,18,11,18,18,2,2,2,2,2,2,0,2,0,0,0,0,0,2,0,0,
+                5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,4,18,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,6,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,18,18,16,17,16,17,18,18,
+                18,16,17,18,16,17,18,18,18,18,18,18,18,18,18,13,18,18,13,18,16,17,18,18,
+                16,17,14,15,14,15,14,15,14,15,18,18,18,18,18,4,18,18,18,18,18,18,18,18,
+                18,18,13,13,18,18,18,18,13,18,14,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                22,22,18,18,18,14,15,14,15,14,15,14,15,13,0,0,22,22,22,22,22,22,22,22,
+                22,22,0,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,0,0,0,
+                22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,
+                22,22,22,22,0,0,0,0,23,18,18,18,22,4,5,10,14,15,14,15,14,15,14,15,
+                14,15,22,22,14,15,14,15,14,15,14,15,13,14,15,15,22,10,10,10,10,10,10,10,
+                10,10,6,6,6,6,7,7,13,4,4,4,4,4,22,22,10,10,10,4,5,18,22,22,
+                5,5,5,5,5,5,5,0,0,6,6,21,21,4,4,5,5,5,5,5,5,5,5,5,
+                5,5,5,18,4,4,4,5,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+                22,22,11,11,11,11,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,0,11,11,11,11,11,11,11,11,11,11,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,11,11,11,11,11,11,11,11,22,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,5,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,4,18,18,18,9,9,9,9,9,9,9,9,
+                9,9,5,5,0,0,0,0,1,2,1,2,1,2,1,2,1,2,1,2,1,2,5,6,
+                8,8,8,18,6,6,6,6,6,6,6,6,6,6,18,4,1,2,1,2,1,2,1,2,
+                1,2,1,2,4,4,6,6,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,
+                6,6,18,18,18,18,18,18,0,0,0,0,0,0,0,0,21,21,21,21,21,21,21,4,
+                4,4,4,4,4,4,4,4,21,21,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+                2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,4,2,2,2,2,2,2,2,
+                2,1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,4,21,21,1,2,1,2,5,
+                1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+                1,2,1,1,1,1,1,2,1,1,1,1,1,2,1,2,1,2,1,2,1,2,1,2,
+                1,2,1,2,1,1,1,1,2,1,2,0,0,0,0,0,1,2,0,2,0,2,1,2,
+                1,2,0,0,0,0,0,0,0,0,4,4,4,1,2,5,4,4,2,5,5,5,5,5,
+                5,5,6,5,5,5,6,5,5,5,5,6,5,5,5,5,5,5,5,7,7,6,6,7,
+                22,22,22,22,6,0,0,0,11,11,11,11,11,11,22,22,20,22,0,0,0,0,0,0,
+                5,5,5,5,18,18,18,18,0,0,0,0,0,0,0,0,7,7,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,7,7,7,7,7,7,7,7,7,
+                7,7,7,7,6,6,0,0,0,0,0,0,0,0,18,18,6,6,5,5,5,5,5,5,
+                18,18,18,5,18,5,5,6,5,5,5,5,5,5,6,6,6,6,6,6,6,6,18,18,
+                5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,7,7,0,0,0,0,
+                0,0,0,0,0,0,0,18,5,5,5,6,7,7,6,6,6,6,7,7,6,6,7,7,
+                7,18,18,18,18,18,18,18,18,18,18,18,18,18,0,4,9,9,9,9,9,9,9,9,
+                9,9,0,0,0,0,18,18,5,5,5,5,5,6,4,5,5,5,5,5,5,5,5,5,
+                9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
+                5,6,6,6,6,6,6,7,7,6,6,7,7,6,6,0,0,0,0,0,0,0,0,0,
+                5,5,5,6,5,5,5,5,5,5,5,5,6,7,0,0,9,9,9,9,9,9,9,9,
+                9,9,0,0,18,18,18,18,4,5,5,5,5,5,5,22,22,22,5,7,6,7,5,5,
+                6,5,6,6,6,5,5,6,6,5,5,5,5,5,6,6,5,6,5,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,4,18,18,
+                5,5,5,5,5,5,5,5,5,5,5,7,6,6,7,7,18,18,5,4,4,7,6,0,
+                0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,0,
+                0,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+                2,2,2,21,4,4,4,4,2,2,2,2,2,2,2,2,2,4,21,21,0,0,0,0,
+                5,5,5,7,7,6,7,7,6,7,7,18,7,6,0,0,5,5,5,5,0,0,0,0,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,0,0,0,0,5,5,5,5,5,
+                28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,29,
+                29,29,29,29,29,29,29,29,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+                0,0,0,2,2,2,2,2,0,0,0,0,0,5,6,5,5,5,5,5,5,5,5,5,
+                5,19,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,0,5,0,
+                5,5,0,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,15,14,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,22,5,5,5,5,5,5,5,5,
+                5,5,5,5,20,22,22,22,18,18,18,18,18,18,18,14,15,18,0,0,0,0,0,0,
+                18,13,13,12,12,14,15,14,15,14,15,14,15,14,15,14,15,14,15,14,15,18,18,14,
+                15,18,18,18,18,12,12,12,18,18,18,0,18,18,18,18,13,14,15,14,15,14,15,18,
+                18,18,19,13,19,19,19,0,18,20,18,18,0,0,0,0,5,5,5,5,5,0,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,27,
+                0,18,18,18,20,18,18,18,14,15,18,19,18,13,18,18,2,2,2,2,2,2,2,2,
+                2,2,2,14,19,15,19,14,15,18,14,15,18,18,5,5,5,5,5,5,5,5,5,5,
+                4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,4,4,0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,
+                0,0,5,5,5,5,5,5,0,0,5,5,5,0,0,0,20,20,19,21,22,20,20,0,
+                22,19,19,19,19,22,22,0,0,0,0,0,0,0,0,0,0,27,27,27,22,22,0,0,
+                5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,0,5,5,0,5,18,18,18,0,0,0,0,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,0,0,0,22,22,22,22,22,22,22,22,22,10,10,10,10,10,11,11,11,
+                11,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,11,22,22,22,0,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,0,0,0,22,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,22,22,22,22,22,6,0,0,
+                6,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,0,0,0,0,11,11,11,11,0,0,0,0,0,0,0,0,0,5,5,5,
+                5,10,5,5,5,5,5,5,5,5,10,0,0,0,0,0,5,5,5,5,5,5,6,6,
+                6,6,6,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,18,
+                5,5,5,5,0,0,0,0,5,5,5,5,5,5,5,5,18,10,10,10,10,10,0,0,
+                0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+                1,1,1,1,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,0,0,0,0,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+                5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,18,1,1,1,1,1,1,1,1,
+                1,1,1,0,1,1,1,1,1,1,1,0,1,1,0,2,2,2,2,2,2,2,2,2,
+                2,2,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,2,
+                2,2,0,2,2,0,0,0,4,4,4,4,4,4,0,4,4,4,4,4,4,4,4,4,
+                4,0,4,4,4,4,4,4,4,4,4,0,0,0,0,0,5,5,5,5,5,5,0,0,
+                5,0,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,0,0,0,5,0,0,5,
+                5,5,5,5,5,5,0,18,11,11,11,11,11,11,11,11,5,5,5,5,5,5,5,22,
+                22,11,11,11,11,11,11,11,0,0,0,0,0,0,0,11,11,11,11,11,11,11,11,11,
+                5,5,5,0,5,5,0,0,0,0,0,11,11,11,11,11,5,5,5,5,5,5,11,11,
+                11,11,11,11,0,0,0,18,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,18,
+                5,5,5,5,5,5,5,5,0,0,0,0,11,11,5,5,0,0,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,5,6,6,6,0,6,6,0,0,0,0,0,6,6,6,6,
+                5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+                6,6,6,0,0,0,0,6,11,11,11,11,11,11,11,11,11,0,0,0,0,0,0,0,
+                18,18,18,18,18,18,18,18,18,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,11,11,18,5,5,5,5,5,5,5,5,5,5,5,5,5,11,11,11,
+                5,5,5,5,5,5,5,5,22,5,5,5,5,5,5,5,5,5,5,5,5,6,6,0,
+                0,0,0,11,11,11,11,11,18,18,18,18,18,18,18,0,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,5,0,0,0,18,18,18,18,18,18,18,5,5,5,5,5,5,0,0,
+                11,11,11,11,11,11,11,11,5,5,5,0,0,0,0,0,11,11,11,11,11,11,11,11,
+                5,5,0,0,0,0,0,0,0,18,18,18,18,0,0,0,0,0,0,0,0,0,0,0,
+                0,11,11,11,11,11,11,11,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                2,2,2,0,0,0,0,0,0,0,11,11,11,11,11,11,5,5,5,5,6,6,6,6,
+                0,0,0,0,0,0,0,0,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,0,
+                5,5,5,5,5,5,5,5,5,5,0,6,6,13,0,0,5,5,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,11,11,11,11,11,11,11,5,0,0,0,0,0,0,0,0,
+                6,11,11,11,11,18,18,18,18,18,0,0,0,0,0,0,5,5,6,6,6,6,18,18,
+                18,18,0,0,0,0,0,0,5,5,5,5,5,11,11,11,11,11,11,11,0,0,0,0,
+                7,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,18,18,18,18,18,18,18,0,0,
+                11,11,11,11,11,11,9,9,9,9,9,9,9,9,9,9,6,5,5,6,6,5,0,0,
+                0,0,0,0,0,0,0,6,7,7,7,6,6,6,6,7,7,6,6,18,18,27,18,18,
+                18,18,6,0,0,0,0,0,0,0,0,0,0,27,0,0,6,6,6,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,7,6,6,6,
+                6,6,6,6,6,0,9,9,9,9,9,9,9,9,9,9,18,18,18,18,5,7,7,5,
+                0,0,0,0,0,0,0,0,5,5,5,6,18,18,5,0,0,0,0,0,0,0,0,0,
+                5,5,5,7,7,7,6,6,6,6,6,6,6,6,6,7,7,5,5,5,5,18,18,18,
+                18,6,6,6,6,18,7,6,9,9,9,9,9,9,9,9,9,9,5,18,5,18,18,18,
+                0,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,0,0,0,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,6,
+                6,6,7,7,6,7,6,6,18,18,18,18,18,18,6,0,5,5,5,5,5,5,5,0,
+                5,0,5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
+                5,5,5,5,5,5,5,5,5,18,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,6,7,7,7,6,6,6,6,6,6,6,6,0,0,0,0,0,
+                6,6,7,7,0,5,5,5,5,5,5,5,5,0,0,5,5,0,5,5,0,5,5,5,
+                5,5,0,6,6,5,7,7,6,7,7,7,7,0,0,7,7,0,0,7,7,7,0,0,
+                5,0,0,0,0,0,0,7,0,0,0,0,0,5,5,5,5,5,7,7,0,0,6,6,
+                6,6,6,6,6,0,0,0,6,6,6,6,6,0,0,0,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,7,7,7,6,6,6,6,6,6,6,6,7,7,6,6,6,7,6,5,
+                5,5,5,18,18,18,18,18,9,9,9,9,9,9,9,9,9,9,18,18,0,18,6,5,
+                7,7,7,6,6,6,6,6,6,7,6,7,7,7,7,6,6,7,6,6,5,5,18,5,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,
+                7,7,6,6,6,6,0,0,7,7,7,7,6,6,7,6,6,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,5,5,5,5,6,6,0,0,
+                7,7,7,6,6,6,6,6,6,6,6,7,7,6,7,6,6,18,18,18,5,0,0,0,
+                0,0,0,0,0,0,0,0,18,18,18,18,18,18,18,18,18,18,18,18,18,0,0,0,
+                5,5,5,5,5,5,5,5,5,5,5,6,7,6,7,7,6,6,6,6,6,6,7,6,
+                5,18,0,0,0,0,0,0,7,7,6,6,6,6,7,6,6,6,6,6,0,0,0,0,
+                9,9,9,9,9,9,9,9,9,9,11,11,18,18,18,22,6,6,6,6,6,6,6,6,
+                7,6,6,18,0,0,0,0,11,11,11,0,0,0,0,0,0,0,0,0,0,0,0,5,
+                5,5,5,5,5,5,5,0,0,5,0,0,5,5,5,5,5,5,5,5,0,5,5,0,
+                5,5,5,5,5,5,5,5,7,7,7,7,7,7,0,7,7,0,0,6,6,7,6,5,
+                7,5,7,6,18,18,18,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                0,0,5,5,5,5,5,5,5,7,7,7,6,6,6,6,0,0,6,6,7,7,7,7,
+                6,5,18,5,7,0,0,0,0,0,0,0,0,0,0,0,5,6,6,6,6,6,6,6,
+                6,6,6,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,5,6,6,6,6,18,
+                18,18,18,18,18,18,18,6,0,0,0,0,0,0,0,0,5,6,6,6,6,6,6,7,
+                7,6,6,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,
+                6,6,6,6,6,6,6,7,6,6,18,18,18,5,18,18,18,18,18,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,0,6,6,6,6,6,6,7,6,
+                5,18,18,18,18,18,0,0,0,0,0,0,0,0,0,0,18,18,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                6,6,6,6,6,6,6,6,0,7,6,6,6,6,6,6,6,7,6,6,7,6,6,0,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,0,5,5,0,5,5,5,5,5,
+                5,6,6,6,6,6,6,0,0,0,6,0,6,6,0,6,6,6,6,6,6,6,5,6,
+                0,0,0,0,0,0,0,0,5,5,5,5,5,5,0,5,5,0,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,7,7,7,7,7,0,6,6,0,7,7,6,7,6,
+                5,0,0,0,0,0,0,0,5,5,5,6,6,7,7,18,18,0,0,0,0,0,0,0,
+                11,11,11,11,11,22,22,22,22,22,22,22,22,20,20,20,20,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,0,0,0,0,18,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,0,18,18,18,18,18,0,0,0,
+                0,0,0,0,0,0,0,0,5,18,18,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                27,27,27,27,27,27,27,27,27,0,0,0,0,0,0,0,6,6,6,6,6,18,0,0,
+                0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,18,18,18,18,18,22,22,22,22,
+                4,4,4,4,18,22,0,0,0,0,0,0,0,0,0,0,9,9,9,9,9,9,9,9,
+                9,9,0,11,11,11,11,11,11,11,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,0,0,0,0,0,5,5,5,11,11,11,11,11,11,11,18,
+                18,18,18,0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,6,
+                5,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+                7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,0,0,0,0,0,0,0,6,
+                6,6,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,18,4,6,0,0,0,
+                0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                4,4,4,4,0,4,4,4,4,4,4,4,0,4,4,0,5,5,5,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,5,5,5,5,5,0,0,22,6,6,18,27,27,27,27,0,0,0,0,
+                0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,0,
+                6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,0,
+                0,22,22,22,22,22,22,22,22,22,22,22,22,7,7,6,6,6,22,22,22,7,7,7,
+                7,7,7,27,27,27,27,27,27,27,27,6,6,6,6,6,6,6,6,22,22,6,6,6,
+                6,6,6,6,22,22,22,22,22,22,22,22,22,22,22,22,22,22,6,6,6,6,22,22,
+                22,22,6,6,6,22,0,0,0,0,0,0,0,0,0,0,11,11,11,11,0,0,0,0,
+                0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+                2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+                1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,1,0,1,1,0,0,1,0,0,1,1,0,0,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,2,2,2,2,0,2,0,2,2,2,2,2,2,2,0,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,1,1,0,1,1,1,1,0,0,1,1,1,
+                1,1,1,1,1,0,1,1,1,1,1,1,1,0,2,2,2,2,2,2,2,2,2,2,
+                1,1,0,1,1,1,1,0,1,1,1,1,1,0,1,0,0,0,1,1,1,1,1,1,
+                1,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,0,0,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,19,2,2,2,2,
+                2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,19,2,2,2,2,2,2,2,2,2,19,2,2,2,2,2,2,1,1,1,1,
+                1,1,1,1,1,19,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,19,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,2,2,
+                2,19,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,
+                2,2,2,19,2,2,2,2,2,2,1,2,0,0,9,9,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,6,6,6,6,6,6,6,22,22,22,22,6,6,6,6,6,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,22,22,22,22,22,22,22,22,6,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,6,22,22,18,18,18,18,18,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,2,2,2,2,2,2,2,2,
+                2,2,5,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+                6,6,6,6,6,6,6,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                6,0,0,6,6,6,6,6,6,6,0,6,6,0,6,6,6,6,6,0,0,0,0,0,
+                6,6,6,6,6,6,6,4,4,4,4,4,4,4,0,0,9,9,9,9,9,9,9,9,
+                9,9,0,0,0,0,5,22,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,0,
+                5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,9,9,9,9,9,9,9,9,
+                9,9,0,0,0,0,0,20,5,5,5,5,5,5,5,0,5,5,5,5,0,5,5,0,
+                5,5,5,5,5,0,0,11,11,11,11,11,11,11,11,11,2,2,2,2,6,6,6,6,
+                6,6,6,4,0,0,0,0,11,11,11,11,11,11,11,11,11,11,11,11,22,11,11,11,
+                20,11,11,11,11,0,0,0,0,0,0,0,0,0,0,0,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,22,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,0,0,
+                5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,0,5,5,0,5,0,0,5,
+                0,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,5,0,5,0,0,0,0,
+                0,0,5,0,0,0,0,5,0,5,0,5,0,5,5,5,0,5,5,0,5,0,0,5,
+                0,5,0,5,0,5,0,5,0,5,5,0,5,0,0,5,5,5,5,0,5,5,5,5,
+                5,5,5,0,5,5,5,5,0,5,5,5,5,0,5,0,5,5,5,5,5,5,5,5,
+                5,5,0,5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,0,5,5,5,5,5,
+                19,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,11,11,11,11,11,11,11,11,11,11,11,11,11,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,22,22,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,22,22,22,21,21,21,21,21,
+                22,22,22,22,22,22,22,22,0,0,0,0,0,22,22,22,22,22,22,22,22,22,22,22,
+                0,0,0,0,0,0,0,0,22,22,22,22,22,0,0,0,22,22,22,22,22,0,0,0,
+                22,22,22,0,22,22,22,22,22,22,22,22,22,22,22,22,0,27,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+                29,29,29,29,29,29,29,29,29,29,29,29,29,29,0,0,
+            };
+            static constexpr uint8_t script_stage1[2176] = {
+                0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,17,19,20,21,22,
+                23,24,25,25,25,25,25,25,25,25,25,25,25,25,26,25,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,25,25,27,27,28,29,30,31,32,32,32,32,32,32,32,32,32,32,
+                32,32,32,32,32,32,32,32,32,32,32,33,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,
+                55,56,57,34,34,34,34,58,59,59,60,34,34,34,34,34,34,34,61,62,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,63,64,34,65,66,66,66,66,66,66,66,66,
+                66,66,66,67,66,68,69,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,70,
+                71,72,34,34,34,34,73,34,34,34,34,34,34,34,34,74,75,76,77,78,79,80,34,81,
+                82,83,34,84,85,34,86,87,88,89,17,90,91,92,34,34,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+                25,25,25,93,25,25,25,25,25,25,25,94,95,25,25,25,25,25,25,25,25,25,25,96,
+                25,25,25,25,25,25,25,25,25,25,25,25,25,97,34,34,34,34,34,34,25,98,34,34,
+                25,25,25,25,25,25,25,25,25,99,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,100,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+            };
+            static constexpr uint16_t script_stage2[3232] = {
+                0,0,0,0,1,2,1,2,0,0,3,3,4,5,4,5,4,4,4,4,4,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,6,0,0,7,0,
+                8,8,8,8,8,8,8,9,10,11,12,11,11,11,13,11,14,14,14,14,14,14,14,14,
+                15,14,14,14,14,14,14,14,14,14,14,16,17,18,17,17,19,20,21,21,22,21,23,24,
+                25,26,27,27,28,29,27,30,27,27,27,27,27,31,27,27,32,33,33,33,34,27,27,27,
+                35,35,35,36,37,37,37,38,39,39,40,41,42,43,44,27,45,46,27,27,27,27,47,27,
+                48,48,48,48,48,49,50,48,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,
+                67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,
+                91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,109,110,111,112,109,
+                113,114,115,116,117,118,119,120,121,122,122,123,122,124,125,125,126,127,128,129,130,131,125,125,
+                132,132,132,132,133,132,134,135,132,133,132,136,136,137,125,125,138,138,138,138,138,138,138,138,
+                138,138,139,139,140,139,139,141,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+                143,143,143,143,144,145,143,143,144,143,143,146,147,148,143,143,143,147,143,143,143,149,143,150,
+                143,151,152,152,152,152,152,153,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
+                154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,
+                155,156,157,157,157,157,158,159,160,161,162,163,164,165,166,167,168,168,168,168,168,169,170,170,
+                171,172,173,173,173,173,173,174,173,173,175,154,154,154,154,176,177,178,179,179,180,181,182,183,
+                184,184,185,184,186,187,168,168,188,189,190,190,190,191,190,192,193,193,194,8,195,125,125,125,
+                196,196,196,196,197,196,196,198,199,199,199,199,200,200,200,201,202,202,202,203,204,205,205,205,
+                206,139,139,207,208,209,210,211,4,4,212,4,4,213,214,215,4,4,4,216,8,8,8,8,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,11,217,11,11,217,218,11,219,
+                11,11,11,220,220,221,11,222,223,0,0,0,0,0,224,225,226,227,0,0,228,8,8,229,
+                0,0,230,231,232,0,4,4,233,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,234,125,235,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,236,236,236,236,236,236,236,236,236,236,236,236,236,236,236,236,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,237,0,238,0,0,0,0,0,0,
+                239,239,239,239,239,239,4,4,240,240,240,240,240,240,240,241,139,139,140,242,242,242,243,244,
+                143,245,246,246,246,246,14,14,0,0,0,0,0,247,125,125,248,249,248,248,248,248,248,250,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,251,125,252,253,0,254,255,256,257,257,257,
+                257,258,259,260,260,260,260,261,262,263,263,264,142,142,142,142,265,0,263,263,0,0,266,260,
+                142,265,0,0,0,0,142,267,0,0,0,0,0,260,260,268,260,260,260,260,260,269,0,0,
+                0,0,0,0,0,0,0,0,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,0,0,0,0,
+                270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,
+                270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,270,271,270,270,270,272,273,273,273,
+                274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,274,275,125,14,14,14,14,
+                14,14,276,276,276,276,276,277,0,0,278,4,4,4,4,4,279,4,4,4,280,281,125,282,
+                283,283,284,285,286,286,286,287,288,288,288,288,289,290,48,48,291,291,292,293,293,294,142,295,
+                296,296,296,296,297,298,138,299,300,300,300,301,302,303,138,138,304,304,304,304,305,306,307,308,
+                309,310,246,4,4,311,312,152,152,152,152,152,307,307,313,314,142,142,142,142,142,142,142,142,
+                142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+                142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+                142,142,315,142,316,142,142,317,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,318,248,248,248,248,248,248,319,125,125,320,321,21,322,323,27,27,27,
+                27,27,27,27,324,325,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+                27,27,27,326,27,27,27,27,27,327,27,27,328,125,125,27,8,285,329,0,0,330,331,332,
+                27,27,27,27,27,27,27,333,334,0,1,2,1,2,335,259,260,336,142,265,337,338,339,340,
+                341,342,343,344,345,345,125,125,342,342,342,342,342,342,342,346,347,0,0,348,11,11,11,11,
+                349,350,351,125,125,0,0,352,125,125,125,125,125,125,125,125,353,354,355,355,355,356,357,252,
+                358,358,359,360,361,362,362,363,364,365,366,366,367,368,125,125,369,369,369,369,369,370,370,370,
+                371,372,373,374,374,375,374,376,377,377,378,379,379,379,380,381,381,382,383,384,125,125,125,125,
+                385,385,385,385,385,385,385,385,385,385,385,385,385,385,385,385,385,385,385,386,385,387,388,125,
+                389,4,4,390,125,125,125,125,391,392,392,393,394,395,396,396,397,398,399,125,125,125,400,401,
+                402,403,404,405,125,125,125,125,406,406,407,408,407,409,407,407,410,411,412,413,414,414,415,415,
+                416,416,125,125,417,417,418,419,420,420,420,421,422,423,424,425,426,427,428,125,125,125,125,125,
+                429,429,429,429,430,125,125,125,431,431,431,432,431,431,431,433,434,434,435,436,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,27,45,437,437,438,439,125,125,125,125,
+                440,440,441,442,442,443,125,444,445,125,125,446,447,125,448,449,450,450,450,450,451,452,450,453,
+                454,454,454,454,455,456,457,458,459,459,459,460,461,462,462,463,464,464,464,464,464,464,465,466,
+                467,468,467,469,125,125,125,125,470,471,472,473,473,473,474,475,476,477,478,479,480,481,482,483,
+                125,125,125,125,125,125,125,125,484,484,484,484,484,485,486,125,487,487,487,487,488,489,125,125,
+                125,125,125,125,125,125,125,125,490,490,490,491,490,492,125,125,493,493,493,493,494,495,496,125,
+                497,497,497,498,498,125,125,125,499,500,501,499,502,125,125,125,125,125,125,125,125,125,125,125,
+                503,503,503,504,125,125,125,125,125,125,505,505,505,505,505,506,507,508,509,510,511,512,125,125,
+                125,125,513,514,514,513,515,125,516,516,516,516,517,518,518,518,518,518,519,154,520,520,520,521,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,522,523,523,524,525,523,526,527,
+                527,528,529,530,125,125,125,125,531,532,532,533,534,535,536,537,538,539,540,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,541,542,125,125,125,125,125,125,125,125,
+                125,125,125,543,544,544,544,545,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,
+                546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,
+                546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,546,547,125,125,125,125,125,125,
+                546,546,546,546,546,546,548,549,546,546,546,546,546,546,546,546,546,546,546,546,550,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,551,551,551,551,551,551,552,553,553,553,553,553,553,553,553,
+                553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,553,
+                553,553,554,555,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,
+                556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,556,557,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,276,
+                276,276,276,276,276,276,276,276,276,276,276,558,559,560,561,562,562,562,562,563,564,565,566,567,
+                568,568,568,568,569,570,571,572,568,125,125,125,125,125,125,125,125,125,125,125,573,573,573,573,
+                573,574,125,125,125,125,125,125,575,575,575,575,576,575,575,575,577,575,125,125,125,125,578,579,
+                580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,
+                580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,
+                580,580,580,580,580,580,580,580,580,580,580,580,580,580,580,581,580,580,580,580,580,580,580,580,
+                580,580,580,580,580,580,580,580,582,582,582,582,582,582,582,582,582,582,582,582,582,582,582,582,
+                582,582,582,582,582,582,582,582,582,582,582,582,582,583,125,125,584,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,585,586,257,257,257,257,257,257,257,
+                257,257,257,257,257,257,257,257,257,257,587,125,125,588,589,590,590,590,590,590,590,590,590,590,
+                590,590,590,590,590,590,590,590,590,590,590,590,590,590,590,591,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,592,592,592,592,592,592,593,594,595,596,266,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,8,8,597,8,598,0,0,0,0,0,0,0,266,125,125,125,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,599,0,0,600,0,0,0,601,602,
+                603,0,604,0,0,0,235,125,11,11,11,11,605,125,125,125,125,125,125,125,125,125,0,266,
+                0,0,0,0,0,234,0,606,125,125,125,125,125,125,125,125,0,0,0,0,0,224,0,0,
+                0,607,608,609,610,0,0,0,611,612,0,613,614,615,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,616,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,617,0,0,0,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+                618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,618,
+                619,620,621,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,4,622,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,623,624,625,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                626,626,627,628,629,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,630,631,125,632,632,632,633,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,634,635,636,636,636,636,636,636,636,636,636,636,636,636,637,638,125,125,
+                639,639,639,639,640,641,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,334,
+                0,0,0,642,125,125,125,125,334,0,0,247,125,125,125,125,125,125,125,125,125,125,125,125,
+                643,27,644,645,646,647,648,649,650,651,652,651,125,125,125,653,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,0,0,252,0,0,0,0,0,0,266,226,334,334,334,0,599,
+                0,0,0,0,0,0,0,0,0,0,247,125,125,125,654,0,655,0,0,252,606,656,599,125,
+                125,125,125,125,125,125,125,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,657,350,350,0,0,0,0,0,0,0,266,
+                0,0,0,0,0,606,252,228,252,0,0,0,658,285,0,0,658,0,247,656,125,125,125,125,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,266,247,659,
+                234,0,350,235,599,285,658,234,0,0,0,0,0,0,0,0,0,330,0,0,235,125,125,285,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,125,125,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,660,248,248,248,248,248,248,248,248,248,248,248,248,248,318,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,579,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,661,125,248,318,125,125,125,125,125,125,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,662,125,125,125,
+                125,125,125,125,125,125,125,125,663,125,0,0,0,0,0,0,125,125,125,125,125,125,125,125,
+                8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,125,
+            };
+            static constexpr uint8_t script_stage3[10624] = {
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,70,1,1,1,1,1,70,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,1,70,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,70,70,1,1,1,1,1,1,1,70,70,70,70,70,1,1,1,
+                1,1,15,15,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                45,45,45,45,1,45,45,45,0,0,45,45,45,45,1,45,0,0,0,0,45,1,45,1,
+                45,45,45,0,45,0,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+                45,45,0,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,27,27,27,27,27,27,
+                27,27,27,27,27,27,27,27,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+                31,31,31,31,31,2,2,31,31,31,31,31,31,31,31,31,0,7,7,7,7,7,7,7,
+                7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+                7,7,7,7,7,7,7,0,0,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+                7,7,7,0,0,7,7,7,0,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+                54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+                0,0,0,0,0,0,0,0,54,54,54,54,54,54,54,54,54,54,54,0,0,0,0,54,
+                54,54,54,54,54,0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,1,6,6,
+                6,6,6,6,1,6,6,6,6,6,6,6,6,6,6,6,6,6,6,1,6,6,6,1,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,1,6,6,6,6,6,6,6,
+                6,6,6,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,
+                2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                6,6,6,6,6,1,6,6,137,137,137,137,137,137,137,137,137,137,137,137,137,137,0,137,
+                137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,
+                137,137,137,0,0,137,137,137,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,
+                148,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,100,100,100,100,100,100,100,
+                100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,0,0,100,100,100,
+                125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,
+                125,125,125,125,125,125,0,0,125,125,125,125,125,125,125,125,125,125,125,125,125,125,125,0,
+                81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+                81,81,81,81,0,0,81,0,137,137,137,137,137,137,137,137,137,137,137,0,0,0,0,0,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,6,6,0,0,0,0,0,0,
+                6,6,6,6,6,6,6,6,6,6,1,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,2,2,2,2,33,33,33,
+                33,33,33,33,33,33,33,33,33,33,33,33,1,1,33,33,33,33,33,33,33,33,33,33,
+                13,13,13,13,0,13,13,13,13,13,13,13,13,0,0,13,13,0,0,13,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,0,13,13,13,13,13,13,
+                13,0,13,0,0,0,13,13,13,13,0,0,13,13,13,13,13,13,13,13,13,0,0,13,
+                13,0,0,13,13,13,13,0,0,0,0,0,0,0,0,13,0,0,0,0,13,13,0,13,
+                13,13,13,13,0,0,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+                13,13,13,13,13,13,13,0,0,48,48,48,0,48,48,48,48,48,48,0,0,0,0,48,
+                48,0,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+                48,0,48,48,48,48,48,48,48,0,48,48,0,48,48,0,48,48,0,0,48,0,48,48,
+                48,48,48,0,0,0,0,48,48,0,0,48,48,48,0,0,0,48,0,0,0,0,0,0,
+                0,48,48,48,48,0,48,0,0,0,0,0,0,0,48,48,48,48,48,48,48,48,48,48,
+                48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,46,46,46,0,46,46,46,
+                46,46,46,46,46,46,0,46,46,46,0,46,46,46,46,46,46,46,46,46,46,46,46,46,
+                46,46,46,46,46,46,46,46,46,0,46,46,46,46,46,46,46,0,46,46,0,46,46,46,
+                46,46,0,0,46,46,46,46,46,46,46,46,46,46,0,46,46,46,0,46,46,46,0,0,
+                46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,46,46,46,0,0,46,46,
+                46,46,46,46,46,46,46,46,46,46,0,0,0,0,0,0,0,46,46,46,46,46,46,46,
+                0,114,114,114,0,114,114,114,114,114,114,114,114,0,0,114,114,0,0,114,114,114,114,114,
+                114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,0,114,114,114,114,114,114,
+                114,0,114,114,0,114,114,114,114,114,0,0,114,114,114,114,114,114,114,114,114,0,0,114,
+                114,0,0,114,114,114,0,0,0,0,0,0,0,114,114,114,0,0,0,0,114,114,0,114,
+                114,114,114,114,0,0,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,114,
+                0,0,0,0,0,0,0,0,0,0,144,144,0,144,144,144,144,144,144,0,0,0,144,144,
+                144,0,144,144,144,144,0,0,0,144,144,0,144,0,144,144,0,0,0,144,144,0,0,0,
+                144,144,144,0,0,0,144,144,144,144,144,144,144,144,144,144,144,144,0,0,0,0,144,144,
+                144,144,144,0,0,0,144,144,144,0,144,144,144,144,0,0,144,0,0,0,0,0,0,144,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,144,144,144,144,144,144,144,144,144,
+                144,144,144,144,144,144,144,144,144,144,144,0,0,0,0,0,147,147,147,147,147,147,147,147,
+                147,147,147,147,147,0,147,147,147,0,147,147,147,147,147,147,147,147,147,147,147,147,147,147,
+                147,147,147,147,147,147,147,147,147,0,147,147,147,147,147,147,147,147,147,147,147,147,147,147,
+                147,147,0,0,147,147,147,147,147,147,147,147,147,0,147,147,147,0,147,147,147,147,0,0,
+                0,0,0,0,0,147,147,0,147,147,147,0,0,147,0,0,147,147,147,147,0,0,147,147,
+                147,147,147,147,147,147,147,147,0,0,0,0,0,0,0,147,147,147,147,147,147,147,147,147,
+                61,61,61,61,61,61,61,61,61,61,61,61,61,0,61,61,61,0,61,61,61,61,61,61,
+                61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,0,61,61,61,61,61,61,
+                61,61,61,61,0,61,61,61,61,61,0,0,61,61,61,61,61,61,61,61,61,0,61,61,
+                61,0,61,61,61,61,0,0,0,0,0,0,0,61,61,0,0,0,0,0,0,61,61,0,
+                61,61,61,61,0,0,61,61,61,61,61,61,61,61,61,61,0,61,61,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,80,80,80,80,80,80,80,80,80,80,80,80,80,0,80,80,
+                80,0,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+                80,80,80,80,80,80,80,80,80,80,80,80,80,0,80,80,80,0,80,80,80,80,80,80,
+                0,0,0,0,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,0,0,80,80,
+                80,80,80,80,80,80,80,80,0,131,131,131,0,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,0,0,0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,0,131,131,131,131,131,131,131,131,131,0,131,0,0,
+                131,131,131,131,131,131,131,0,0,0,131,0,0,0,0,131,131,131,131,131,131,0,131,0,
+                131,131,131,131,131,131,131,131,0,0,0,0,0,0,131,131,131,131,131,131,131,131,131,131,
+                0,0,131,131,131,0,0,0,0,0,0,0,0,0,0,0,0,149,149,149,149,149,149,149,
+                149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,149,
+                149,149,149,149,149,149,149,149,149,149,149,0,0,0,0,1,149,149,149,149,149,149,149,149,
+                149,149,149,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,69,69,0,69,0,69,69,69,69,69,0,69,69,69,69,69,69,69,69,69,69,69,69,
+                69,69,69,69,69,69,69,69,69,69,69,69,0,69,0,69,69,69,69,69,69,69,69,69,
+                69,69,69,69,69,69,69,69,69,69,69,69,69,69,0,0,69,69,69,69,69,0,69,0,
+                69,69,69,69,69,69,0,0,69,69,69,69,69,69,69,69,69,69,0,0,69,69,69,69,
+                150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,
+                0,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,0,0,0,
+                0,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,150,
+                150,150,150,150,150,0,150,150,150,150,150,150,150,1,1,1,1,150,150,0,0,0,0,0,
+                95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,41,41,41,41,41,41,41,41,
+                41,41,41,41,41,41,41,41,41,41,41,41,41,41,0,41,0,0,0,0,0,41,0,0,
+                41,41,41,41,41,41,41,41,41,41,41,1,41,41,41,41,50,50,50,50,50,50,50,50,
+                50,50,50,50,50,50,50,50,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+                40,40,40,40,40,40,40,40,40,0,40,40,40,40,0,0,40,40,40,40,40,40,40,0,
+                40,0,40,40,40,40,0,0,40,0,40,40,40,40,0,0,40,40,40,40,40,40,40,0,
+                40,0,40,40,40,40,0,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,
+                40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,40,40,40,
+                40,40,40,40,40,40,40,40,40,40,40,40,40,0,0,0,40,40,40,40,40,40,40,40,
+                40,40,0,0,0,0,0,0,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+                25,25,25,25,25,25,0,0,25,25,25,25,25,25,0,0,20,20,20,20,20,20,20,20,
+                20,20,20,20,20,20,20,20,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+                103,103,103,103,103,103,103,103,103,103,103,103,103,0,0,0,124,124,124,124,124,124,124,124,
+                124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,124,1,1,1,124,124,
+                124,124,124,124,124,124,124,124,124,0,0,0,0,0,0,0,138,138,138,138,138,138,138,138,
+                138,138,138,138,138,138,138,138,138,138,138,138,138,138,0,0,0,0,0,0,0,0,0,138,
+                52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,1,1,0,
+                0,0,0,0,0,0,0,0,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,0,0,0,0,0,0,0,0,0,0,0,0,139,139,139,139,139,139,139,139,
+                139,139,139,139,139,0,139,139,139,0,139,139,0,0,0,0,0,0,0,0,0,0,0,0,
+                66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,
+                66,66,66,66,66,66,0,0,66,66,66,66,66,66,66,66,66,66,0,0,0,0,0,0,
+                92,92,1,1,92,1,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+                92,92,0,0,0,0,0,0,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,
+                92,92,92,92,92,92,92,92,92,0,0,0,0,0,0,0,92,92,92,92,92,92,92,92,
+                92,92,92,0,0,0,0,0,20,20,20,20,20,20,0,0,0,0,0,0,0,0,0,0,
+                72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+                72,72,72,72,72,72,72,0,72,72,72,72,72,72,72,72,72,72,72,72,0,0,0,0,
+                72,0,0,0,72,72,72,72,72,72,72,72,72,72,72,72,140,140,140,140,140,140,140,140,
+                140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,140,0,0,
+                140,140,140,140,140,0,0,0,0,0,0,0,0,0,0,0,98,98,98,98,98,98,98,98,
+                98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,0,0,0,0,
+                98,98,98,98,98,98,98,98,98,98,0,0,0,0,0,0,98,98,98,98,98,98,98,98,
+                98,98,98,0,0,0,98,98,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,0,0,18,18,141,141,141,141,141,141,141,141,
+                141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,141,0,
+                141,141,141,141,141,141,141,141,141,141,141,141,141,0,0,141,141,141,141,141,141,141,141,141,
+                141,141,0,0,0,0,0,0,141,141,141,141,141,141,141,141,141,141,141,141,141,141,0,0,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,0,135,135,135,135,135,135,135,135,
+                135,135,135,135,135,135,135,135,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+                12,12,12,12,0,0,0,0,0,0,0,0,12,12,12,12,71,71,71,71,71,71,71,71,
+                71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,0,0,0,71,71,71,71,71,
+                71,71,71,71,71,71,71,71,71,71,0,0,0,71,71,71,104,104,104,104,104,104,104,104,
+                104,104,104,104,104,104,104,104,31,31,31,31,31,31,31,31,31,0,0,0,0,0,0,0,
+                41,41,41,41,41,41,41,41,41,41,41,0,0,41,41,41,135,135,135,135,135,135,135,135,
+                0,0,0,0,0,0,0,0,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,1,2,2,2,2,2,2,2,1,1,1,1,2,1,1,1,1,1,1,2,1,1,1,
+                2,2,1,0,0,0,0,0,70,70,70,70,70,70,45,45,45,45,45,31,70,70,70,70,
+                70,70,70,70,70,70,70,70,70,70,70,70,70,45,45,45,45,45,70,70,70,70,45,45,
+                45,45,45,70,70,70,70,70,70,70,70,70,70,70,70,70,31,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,45,45,45,45,45,45,45,0,0,
+                45,45,45,45,45,45,0,0,45,45,45,45,45,45,45,45,0,45,0,45,0,45,0,45,
+                45,45,45,45,45,45,45,45,45,45,45,45,45,45,0,0,45,45,45,45,45,0,45,45,
+                45,45,45,45,45,45,45,45,45,45,45,45,0,0,45,45,45,45,45,45,0,45,45,45,
+                0,0,45,45,45,0,45,45,45,45,45,45,45,45,45,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,2,2,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+                1,70,0,0,1,1,1,1,1,1,1,1,1,1,1,70,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,0,70,70,70,70,70,70,70,70,70,70,70,70,70,0,0,0,
+                1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,1,1,1,1,1,1,45,1,1,1,70,70,1,1,1,1,
+                1,1,70,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,70,1,70,70,70,70,70,70,70,70,70,1,1,1,0,0,0,0,
+                1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,1,0,0,0,0,0,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+                1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,
+                1,1,1,1,1,1,1,1,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+                27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,0,0,0,0,
+                0,27,27,27,27,27,27,27,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,151,
+                151,151,151,151,151,151,151,151,0,0,0,0,0,0,0,151,151,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,151,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,0,
+                40,40,40,40,40,40,40,0,40,40,40,40,40,40,40,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,0,0,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+                49,49,49,49,49,49,49,49,49,49,0,49,49,49,49,49,49,49,49,49,0,0,0,0,
+                0,0,0,0,0,0,0,0,49,49,49,49,49,49,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,49,1,49,
+                1,1,1,1,1,1,1,1,1,49,49,49,49,49,49,49,49,49,2,2,2,2,50,50,
+                1,1,1,1,1,1,1,1,49,49,49,49,1,1,1,1,0,55,55,55,55,55,55,55,
+                55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+                55,55,55,55,55,55,55,0,0,2,2,1,1,55,55,55,1,62,62,62,62,62,62,62,
+                62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,
+                62,62,62,62,62,62,62,62,62,62,62,1,1,62,62,62,0,0,0,0,0,15,15,15,
+                15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+                0,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+                50,50,50,50,50,50,50,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+                50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,1,62,62,62,62,62,62,62,62,
+                62,62,62,62,62,62,62,1,62,62,62,62,62,62,62,62,1,1,1,1,1,1,1,1,
+                160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,160,
+                160,160,160,160,160,0,0,0,160,160,160,160,160,160,160,0,0,0,0,0,0,0,0,0,
+                75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,155,155,155,155,155,155,155,155,
+                155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,155,0,0,0,0,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                0,0,0,0,0,0,0,0,1,1,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,70,1,1,1,70,70,70,70,70,70,70,70,70,70,70,70,70,
+                70,70,70,0,0,0,0,0,70,70,0,70,0,70,70,70,70,70,0,0,0,0,0,0,
+                0,0,70,70,70,70,70,70,70,70,70,70,70,70,70,70,136,136,136,136,136,136,136,136,
+                136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,120,120,120,120,120,120,120,120,
+                120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,0,0,0,0,0,0,0,0,
+                126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,0,0,
+                0,0,0,0,0,0,126,126,126,126,126,126,126,126,126,126,126,126,0,0,0,0,0,0,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,1,63,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+                123,123,123,123,0,0,0,0,0,0,0,0,0,0,0,123,50,50,50,50,50,50,50,50,
+                50,50,50,50,50,0,0,0,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+                59,59,59,59,59,59,59,59,59,59,59,59,59,59,0,1,59,59,59,59,59,59,59,59,
+                59,59,0,0,0,0,59,59,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,0,
+                24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,0,
+                0,0,0,0,0,0,0,0,24,24,24,24,24,24,24,24,24,24,24,24,24,24,0,0,
+                24,24,24,24,24,24,24,24,24,24,0,0,24,24,24,24,142,142,142,142,142,142,142,142,
+                142,142,142,142,142,142,142,142,142,142,142,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,142,142,142,142,142,86,86,86,86,86,86,86,86,
+                86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,0,0,0,0,0,0,0,0,0,
+                0,40,40,40,40,40,40,0,0,40,40,40,40,40,40,0,0,40,40,40,40,40,40,0,
+                0,0,0,0,0,0,0,0,70,70,70,70,70,70,70,70,70,70,70,1,70,70,70,70,
+                70,70,70,70,70,45,70,70,70,70,1,1,0,0,0,0,86,86,86,86,86,86,86,86,
+                86,86,86,86,86,86,0,0,86,86,86,86,86,86,86,86,86,86,0,0,0,0,0,0,
+                50,50,50,50,0,0,0,0,0,0,0,0,0,0,0,0,50,50,50,50,50,50,50,0,
+                0,0,0,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,0,0,0,0,
+                49,49,49,49,49,49,49,49,49,49,49,49,49,49,0,0,49,49,49,49,49,49,49,49,
+                49,49,0,0,0,0,0,0,70,70,70,70,70,70,70,0,0,0,0,0,0,0,0,0,
+                0,0,0,7,7,7,7,7,0,0,0,0,0,54,54,54,54,54,54,54,54,54,54,0,
+                54,54,54,54,54,0,54,0,54,54,0,54,54,0,54,54,54,54,54,54,54,54,54,54,
+                6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,1,1,
+                0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+                0,0,0,0,0,0,0,6,2,2,2,2,2,2,2,2,2,2,2,2,2,2,31,31,
+                1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+                1,1,1,1,0,0,0,0,6,6,6,6,6,0,6,6,6,6,6,6,6,6,6,6,
+                6,6,6,6,6,6,6,6,6,6,6,6,6,0,0,1,0,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,62,62,62,62,62,62,62,62,62,62,
+                62,62,62,62,62,62,62,62,62,62,62,62,62,62,1,1,0,0,50,50,50,50,50,50,
+                0,0,50,50,50,50,50,50,0,0,50,50,50,50,50,50,0,0,50,50,50,0,0,0,
+                1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+                0,1,1,1,1,1,0,0,74,74,74,74,74,74,74,74,74,74,74,74,0,74,74,74,
+                74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,0,
+                74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,0,74,74,0,74,
+                74,74,74,74,74,74,74,74,74,74,74,74,74,74,0,0,74,74,74,74,74,74,74,74,
+                74,74,74,0,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,45,45,45,45,45,45,45,45,
+                45,45,45,45,45,45,45,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,
+                45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,2,0,0,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+                76,76,76,76,76,76,76,76,76,76,76,76,76,0,0,0,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,106,106,106,106,106,106,106,106,
+                106,106,106,106,106,106,106,106,106,106,106,106,0,0,0,0,0,0,0,0,0,106,106,106,
+                43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,
+                43,43,43,0,0,0,0,0,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+                108,108,108,108,108,108,108,108,108,108,108,0,0,0,0,0,154,154,154,154,154,154,154,154,
+                154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,154,0,154,
+                109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,0,0,0,0,
+                109,109,109,109,109,109,109,109,109,109,109,109,109,109,0,0,0,0,0,0,0,0,0,0,
+                32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,128,128,128,128,128,128,128,128,
+                128,128,128,128,128,128,128,128,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
+                116,116,116,116,116,116,116,116,116,116,116,116,116,116,0,0,116,116,116,116,116,116,116,116,
+                116,116,0,0,0,0,0,0,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+                115,115,115,115,0,0,0,0,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,115,
+                115,115,115,115,0,0,0,0,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+                38,38,38,38,38,38,38,38,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,0,0,0,0,22,
+                156,156,156,156,156,156,156,156,156,156,156,0,156,156,156,156,156,156,156,0,156,156,0,156,
+                156,156,156,156,156,156,156,156,156,156,0,156,156,156,156,156,156,156,156,156,156,156,156,156,
+                156,156,0,156,156,156,156,156,156,156,0,156,156,0,0,0,73,73,73,73,73,73,73,73,
+                73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,0,0,0,0,0,0,0,0,0,
+                73,73,73,73,73,73,0,0,0,0,0,0,0,0,0,0,73,73,73,73,73,73,73,73,
+                0,0,0,0,0,0,0,0,70,70,70,70,70,70,0,70,70,70,70,70,70,70,70,70,
+                70,0,70,70,70,70,70,70,70,70,70,0,0,0,0,0,29,29,29,29,29,29,0,0,
+                29,0,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+                29,29,29,29,29,29,0,29,29,0,0,0,29,0,0,29,56,56,56,56,56,56,56,56,
+                56,56,56,56,56,56,56,56,56,56,56,56,56,56,0,56,56,56,56,56,56,56,56,56,
+                118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,96,96,96,96,96,96,96,96,
+                96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,0,
+                0,0,0,0,0,0,0,96,96,96,96,96,96,96,96,96,53,53,53,53,53,53,53,53,
+                53,53,53,53,53,53,53,53,53,53,53,0,53,53,0,0,0,0,0,53,53,53,53,53,
+                121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+                121,121,121,121,0,0,0,121,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+                77,77,77,77,77,77,77,77,77,77,0,0,0,0,0,77,89,89,89,89,89,89,89,89,
+                89,89,89,89,89,89,89,89,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+                88,88,88,88,88,88,88,88,0,0,0,0,88,88,88,88,0,0,88,88,88,88,88,88,
+                88,88,88,88,88,88,88,88,64,64,64,64,0,64,64,0,0,0,0,0,64,64,64,64,
+                64,64,64,64,0,64,64,64,0,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+                64,64,64,64,64,64,64,64,64,64,64,64,64,64,0,0,64,64,64,0,0,0,0,64,
+                64,64,64,64,64,64,64,64,64,0,0,0,0,0,0,0,111,111,111,111,111,111,111,111,
+                111,111,111,111,111,111,111,111,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+                82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,0,
+                0,0,0,82,82,82,82,82,82,82,82,82,82,82,82,0,0,0,0,0,0,0,0,0,
+                8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,0,0,
+                0,8,8,8,8,8,8,8,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+                58,58,58,58,58,58,0,0,58,58,58,58,58,58,58,58,57,57,57,57,57,57,57,57,
+                57,57,57,57,57,57,57,57,57,57,57,0,0,0,0,0,57,57,57,57,57,57,57,57,
+                122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,0,0,0,0,0,0,
+                0,122,122,122,122,0,0,0,0,0,0,0,0,0,0,0,0,122,122,122,122,122,122,122,
+                112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,112,
+                112,0,0,0,0,0,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,
+                105,105,105,0,0,0,0,0,0,0,0,0,0,0,0,0,105,105,105,0,0,0,0,0,
+                0,0,105,105,105,105,105,105,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+                51,51,51,51,51,51,51,51,0,0,0,0,0,0,0,0,51,51,51,51,51,51,51,51,
+                51,51,0,0,0,0,0,0,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+                159,159,159,159,159,159,159,159,159,159,0,159,159,159,0,0,159,159,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+                110,110,110,110,110,110,110,110,0,0,0,0,0,0,0,0,132,132,132,132,132,132,132,132,
+                132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,132,0,0,0,0,0,0,
+                113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,113,
+                113,113,0,0,0,0,0,0,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+                26,26,26,26,26,26,26,26,26,26,26,26,0,0,0,0,39,39,39,39,39,39,39,39,
+                39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,0,0,0,0,0,0,0,0,0,
+                16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+                16,16,16,16,16,16,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+                16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,16,60,60,60,60,60,60,60,60,
+                60,60,60,60,60,60,60,60,60,60,60,0,0,0,0,0,0,0,0,0,0,60,0,0,
+                133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,133,
+                133,0,0,0,0,0,0,0,133,133,133,133,133,133,133,133,133,133,0,0,0,0,0,0,
+                23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,0,23,23,
+                23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,0,0,0,0,0,0,0,0,
+                78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,0,
+                0,0,0,0,0,0,0,0,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+                0,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,0,0,0,
+                0,0,0,0,0,0,0,0,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+                67,67,0,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,
+                67,67,67,67,67,67,67,0,94,94,94,94,94,94,94,0,94,0,94,94,94,94,0,94,
+                94,94,94,94,94,94,94,94,94,94,94,94,94,94,0,94,94,94,94,94,94,94,94,94,
+                94,94,0,0,0,0,0,0,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+                68,68,68,68,68,68,68,68,68,68,68,0,0,0,0,0,68,68,68,68,68,68,68,68,
+                68,68,0,0,0,0,0,0,44,44,44,44,0,44,44,44,44,44,44,44,44,0,0,44,
+                44,0,0,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+                44,0,44,44,44,44,44,44,44,0,44,44,0,44,44,44,44,44,0,2,44,44,44,44,
+                44,44,44,44,44,0,0,44,44,0,0,44,44,44,0,0,44,0,0,0,0,0,0,44,
+                0,0,0,0,0,44,44,44,44,44,44,44,0,0,44,44,44,44,44,44,44,0,0,0,
+                44,44,44,44,44,0,0,0,0,0,0,0,0,0,0,0,99,99,99,99,99,99,99,99,
+                99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,0,99,99,99,
+                99,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,152,152,152,152,152,152,152,
+                152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,0,0,0,0,0,0,0,0,
+                152,152,152,152,152,152,152,152,152,152,0,0,0,0,0,0,129,129,129,129,129,129,129,129,
+                129,129,129,129,129,129,129,129,129,129,129,129,129,129,0,0,129,129,129,129,129,129,129,129,
+                129,129,129,129,129,129,129,129,129,129,129,129,129,129,0,0,91,91,91,91,91,91,91,91,
+                91,91,91,91,91,91,91,91,91,91,91,91,91,0,0,0,0,0,0,0,0,0,0,0,
+                91,91,91,91,91,91,91,91,91,91,0,0,0,0,0,0,92,92,92,92,92,92,92,92,
+                92,92,92,92,92,0,0,0,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+                143,143,143,143,143,143,143,143,143,143,0,0,0,0,0,0,4,4,4,4,4,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,4,4,4,4,4,4,4,0,
+                0,0,0,0,0,0,0,0,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+                35,35,35,35,35,35,35,35,35,35,35,35,0,0,0,0,158,158,158,158,158,158,158,158,
+                158,158,158,158,158,158,158,158,158,158,158,0,0,0,0,0,0,0,0,0,0,0,0,158,
+                34,34,34,34,34,34,34,0,0,34,0,0,34,34,34,34,34,34,34,34,0,34,34,0,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,0,34,34,0,0,34,34,34,34,34,34,34,34,34,34,34,34,0,
+                0,0,0,0,0,0,0,0,34,34,34,34,34,34,34,34,34,34,0,0,0,0,0,0,
+                97,97,97,97,97,97,97,97,0,0,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+                97,97,97,97,97,97,97,97,97,97,97,97,97,0,0,0,0,0,0,0,0,0,0,0,
+                161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+                0,0,0,0,0,0,0,0,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,134,
+                134,134,134,0,0,0,0,0,0,0,0,0,0,0,0,0,119,119,119,119,119,119,119,119,
+                119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,0,0,0,0,0,0,0,
+                14,14,14,14,14,14,14,14,14,0,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,0,0,0,0,0,0,0,0,0,0,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,0,0,0,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+                0,0,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+                0,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,0,0,0,0,0,0,0,0,
+                84,84,84,84,84,84,84,0,84,84,0,84,84,84,84,84,84,84,84,84,84,84,84,84,
+                84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,0,0,0,84,0,84,84,0,84,
+                84,84,84,84,84,84,84,84,0,0,0,0,0,0,0,0,84,84,84,84,84,84,84,84,
+                84,84,0,0,0,0,0,0,47,47,47,47,47,47,0,47,47,0,47,47,47,47,47,47,
+                47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,
+                47,47,47,47,47,47,47,0,47,47,0,47,47,47,47,47,47,0,0,0,0,0,0,0,
+                47,47,47,47,47,47,47,47,47,47,0,0,0,0,0,0,79,79,79,79,79,79,79,79,
+                79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,0,0,0,0,0,0,0,
+                75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,144,144,144,144,144,144,144,
+                144,144,144,144,144,144,144,144,144,144,0,0,0,0,0,0,0,0,0,0,0,0,0,144,
+                28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+                28,28,0,0,0,0,0,0,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,0,
+                28,28,28,28,28,0,0,0,0,0,0,0,0,0,0,0,28,28,28,28,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,37,37,37,37,37,37,37,37,
+                37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,0,
+                37,37,37,37,37,37,37,37,37,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+                10,10,10,10,10,10,10,10,10,0,0,0,0,0,0,0,93,93,93,93,93,93,93,93,
+                93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,0,
+                93,93,93,93,93,93,93,93,93,93,0,0,0,0,93,93,145,145,145,145,145,145,145,145,
+                145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,0,
+                145,145,145,145,145,145,145,145,145,145,0,0,0,0,0,0,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,0,0,
+                11,11,11,11,11,11,0,0,0,0,0,0,0,0,0,0,117,117,117,117,117,117,117,117,
+                117,117,117,117,117,117,117,117,117,117,117,117,117,117,0,0,0,0,0,0,0,0,0,0,
+                117,117,117,117,117,117,117,117,117,117,0,117,117,117,117,117,117,117,0,117,117,117,117,117,
+                117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,0,0,0,0,0,117,117,117,
+                85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+                85,85,85,0,0,0,0,0,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+                90,90,90,90,90,90,90,90,90,90,90,0,0,0,0,90,90,90,90,90,90,90,90,90,
+                0,0,0,0,0,0,0,90,146,101,49,49,65,0,0,0,0,0,0,0,0,0,0,0,
+                49,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,146,146,146,146,146,146,146,
+                146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,0,0,0,0,0,0,0,0,
+                65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,0,0,
+                0,0,0,0,0,0,0,0,146,146,146,146,146,146,146,146,146,0,0,0,0,0,0,0,
+                62,62,62,62,0,62,62,62,62,62,62,62,0,62,62,0,62,55,55,55,55,55,55,55,
+                55,55,55,55,55,55,55,55,62,62,62,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                55,55,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,62,62,62,
+                0,0,0,0,0,0,0,0,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+                101,101,101,101,101,101,101,101,101,101,101,101,0,0,0,0,36,36,36,36,36,36,36,36,
+                36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,0,0,0,0,0,
+                36,36,36,36,36,36,36,36,36,36,36,36,36,0,0,0,36,36,36,36,36,36,36,36,
+                36,0,0,0,0,0,0,0,36,36,36,36,36,36,36,36,36,36,0,0,36,36,36,36,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,0,
+                0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,
+                2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+                2,2,2,1,1,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,2,2,2,2,1,1,45,45,45,45,45,45,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,0,1,1,0,0,1,0,0,1,1,0,0,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,1,1,1,1,1,0,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,0,0,1,1,1,
+                1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,
+                1,1,0,1,1,1,1,0,1,1,1,1,1,0,1,0,0,0,1,1,1,1,1,1,
+                1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,130,130,130,130,
+                0,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,70,70,70,70,70,70,70,70,
+                70,70,70,70,70,70,70,0,42,42,42,42,42,42,42,0,42,42,42,42,42,42,42,42,
+                42,42,42,42,42,42,42,42,42,0,0,42,42,42,42,42,42,42,0,42,42,0,42,42,
+                42,42,42,0,0,0,0,0,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+                102,102,102,102,102,102,102,102,102,102,102,102,102,0,0,0,102,102,102,102,102,102,102,102,
+                102,102,102,102,102,102,0,0,102,102,102,102,102,102,102,102,102,102,0,0,0,0,102,102,
+                153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,153,
+                153,153,153,153,153,153,153,0,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,
+                157,157,157,157,157,157,157,157,157,157,0,0,0,0,0,157,40,40,40,40,40,40,40,0,
+                40,40,40,40,0,40,40,0,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,0,
+                87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,0,0,87,
+                87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,0,0,0,0,0,0,0,0,0,
+                3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+                3,3,3,3,0,0,0,0,3,3,3,3,3,3,3,3,3,3,0,0,0,0,3,3,
+                1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,0,6,6,6,
+                6,6,6,6,6,6,6,6,0,6,6,0,6,0,0,6,0,6,6,6,6,6,6,6,
+                6,6,6,0,6,6,6,6,0,6,0,6,0,0,0,0,0,0,6,0,0,0,0,6,
+                0,6,0,6,0,6,6,6,0,6,6,0,6,0,0,6,0,6,0,6,0,6,0,6,
+                0,6,6,0,6,0,0,6,6,6,6,0,6,6,6,6,6,6,6,0,6,6,6,6,
+                0,6,6,6,6,0,6,0,6,6,6,6,6,6,6,6,6,6,0,6,6,6,6,6,
+                6,6,6,6,6,6,6,6,6,6,6,6,0,0,0,0,0,6,6,6,0,6,6,6,
+                6,6,0,6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,55,1,1,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,0,1,1,1,1,1,0,0,0,1,1,1,1,1,0,0,0,
+                49,49,49,49,49,49,49,49,49,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,49,49,49,49,49,49,49,49,49,49,49,0,0,0,0,0,
+                0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            };
+            static constexpr uint8_t east_asian_width_stage1[1088] = {
+                0,1,2,2,3,2,2,2,4,5,6,7,8,9,9,9,9,9,9,10,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,11,12,9,9,9,9,9,
+                9,9,9,9,9,13,2,2,14,14,14,14,14,14,15,16,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,17,9,9,9,9,
+                9,18,9,19,2,2,2,2,2,2,2,20,21,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,22,23,24,2,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,25,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+                9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,25,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,26,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,27,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+                14,14,14,14,14,14,14,27,
+            };
+            static constexpr uint8_t east_asian_width_stage2[1792] = {
+                0,0,1,1,1,1,1,2,0,0,3,4,5,6,7,8,9,10,11,12,13,14,11,0,
+                0,0,0,0,15,16,0,0,0,0,0,0,0,9,9,0,0,0,0,0,17,18,0,0,
+                19,19,19,19,19,19,19,0,0,20,21,20,21,0,0,0,9,19,19,19,19,9,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,25,0,0,0,26,
+                27,0,28,0,0,0,0,0,29,30,31,0,0,32,33,34,35,34,0,36,0,37,38,0,
+                39,40,41,42,43,44,45,0,46,47,48,49,0,0,0,0,0,50,51,0,0,0,0,0,
+                0,0,0,0,0,0,52,53,0,0,0,0,0,0,19,19,19,19,19,19,19,19,54,19,
+                19,19,19,19,33,19,19,55,19,56,21,57,58,59,60,61,62,63,0,0,64,65,66,67,
+                0,68,69,70,71,72,73,74,75,0,76,77,78,79,0,80,0,81,0,82,0,0,83,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,85,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,22,87,22,22,22,22,22,65,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,88,0,89,90,22,22,91,92,22,22,22,22,93,22,22,22,22,22,22,
+                94,22,22,92,22,22,22,22,91,22,22,22,22,22,65,22,22,91,22,22,95,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,0,0,0,0,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,96,22,22,22,97,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,96,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,65,0,0,0,0,0,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                19,98,0,22,22,99,100,0,0,0,0,0,0,0,0,0,101,102,102,102,102,102,103,104,
+                104,104,104,105,106,107,108,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,110,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,111,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,88,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,114,0,0,114,115,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,89,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,
+                0,0,0,0,67,0,0,0,117,19,118,19,19,19,34,19,119,120,121,0,0,0,0,0,
+                114,22,22,89,112,110,88,0,0,0,0,0,0,0,0,0,22,22,122,123,22,22,22,124,
+                22,65,22,22,125,65,22,126,22,22,22,91,127,22,22,22,22,22,22,22,22,22,22,128,
+                22,22,22,129,130,22,111,131,0,132,116,0,0,0,0,133,22,22,22,22,22,0,0,0,
+                22,22,22,22,134,135,85,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,137,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,22,22,139,123,22,22,22,
+                22,22,22,22,22,22,22,22,0,0,0,0,0,0,0,140,97,22,96,141,88,98,111,97,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+                22,22,22,22,22,22,22,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,118,
+            };
+            static constexpr uint8_t east_asian_width_stage3[2272] = {
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+                0,1,5,5,1,5,5,1,1,0,1,0,5,1,1,5,1,1,1,1,1,0,1,1,
+                1,1,1,0,1,1,1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+                1,0,0,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,0,0,0,0,1,0,
+                1,1,1,0,1,1,0,0,1,0,1,1,0,0,0,1,1,1,1,0,1,0,1,0,
+                0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,0,
+                0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,0,0,0,
+                0,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,1,1,1,0,1,0,0,0,
+                1,1,1,1,0,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,
+                1,0,1,0,1,0,0,0,0,0,0,0,1,0,0,1,0,1,1,1,0,1,0,0,
+                1,0,0,0,0,0,0,0,1,1,1,1,0,1,0,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,3,3,3,3,3,3,3,3,
+                3,3,3,3,3,3,3,3,1,0,0,1,1,1,1,0,1,1,0,0,1,1,0,0,
+                1,1,1,0,1,1,1,1,0,0,0,0,0,0,0,0,1,0,1,1,0,1,0,0,
+                0,0,0,1,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,
+                0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,2,0,0,1,0,0,0,0,0,0,1,0,1,0,0,0,1,0,0,0,0,0,0,
+                0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,1,0,
+                0,0,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,1,1,1,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,1,0,1,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+                1,0,1,1,0,0,0,1,1,0,0,1,0,0,0,1,0,1,0,0,0,1,0,0,
+                0,0,1,0,0,1,1,1,1,0,0,1,0,1,0,1,1,1,1,1,1,0,1,0,
+                0,0,0,0,1,1,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,
+                1,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,0,0,1,1,1,1,0,0,1,1,0,0,1,1,0,0,1,1,0,0,1,1,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,
+                0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,3,3,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,3,3,3,3,0,0,0,3,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+                0,0,1,1,0,0,1,1,0,0,0,0,1,1,0,0,1,1,0,0,0,0,1,1,
+                1,0,0,1,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,3,3,0,0,0,0,0,0,1,1,0,0,1,0,0,0,0,1,1,
+                0,0,0,0,3,3,0,0,0,0,0,0,1,0,1,0,1,0,1,0,0,0,0,0,
+                3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,0,1,1,1,0,1,1,1,1,0,1,1,0,1,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,0,0,0,0,0,0,0,1,1,
+                0,3,0,0,0,0,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,3,3,1,0,0,0,0,3,3,1,1,1,1,1,1,1,1,3,1,
+                1,1,1,1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,0,0,0,
+                1,1,3,1,1,1,1,1,1,1,3,3,1,3,1,1,1,1,3,1,1,3,1,1,
+                0,0,0,0,0,3,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+                3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,3,0,3,0,0,0,0,3,3,3,0,3,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,3,3,3,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,3,0,0,0,0,0,0,5,5,5,5,5,5,5,5,0,0,
+                0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,3,3,0,0,0,3,0,0,0,0,3,1,1,1,1,0,0,0,0,0,0,
+                3,3,3,3,3,3,3,3,3,3,0,3,3,3,3,3,3,3,3,3,3,3,0,0,
+                0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,
+                4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+                3,3,3,3,3,3,3,0,0,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+                3,3,3,3,3,3,3,0,0,3,3,3,3,3,3,3,0,0,0,0,0,3,3,3,
+                3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,1,1,1,
+                3,3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,3,3,3,3,3,3,3,0,
+                0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,
+                3,3,3,0,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,0,
+                3,3,3,3,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,2,2,2,2,2,2,
+                0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0,2,2,2,0,0,0,
+                4,4,4,4,4,4,4,0,2,2,2,2,2,2,2,0,3,3,3,3,3,0,0,0,
+                0,0,0,0,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,3,
+                3,0,0,0,0,0,0,0,3,3,3,3,0,3,3,3,3,3,3,3,0,3,3,0,
+                3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,
+                0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,1,
+                1,3,3,3,3,3,3,3,3,3,3,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,
+                3,3,3,3,3,3,0,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+                3,3,3,3,3,0,3,3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,3,
+                3,0,0,0,3,0,0,0,3,3,3,3,3,3,3,3,3,0,3,3,3,3,3,3,
+                3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,0,0,3,
+                3,3,3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,
+                0,0,0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,0,3,0,0,0,
+                3,3,3,0,0,3,3,3,0,0,0,0,0,3,3,3,0,0,0,0,3,3,3,3,
+                3,3,3,3,3,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,3,3,3,3,3,
+                3,3,3,0,3,3,3,3,3,3,3,3,3,0,0,0,3,3,3,3,3,0,0,0,
+                3,3,3,3,3,3,3,3,3,3,3,0,0,0,0,0,
+            };
+            static constexpr uint8_t binary_properties_stage1[4352] = {
+                0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,
+                24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,34,40,34,41,42,43,34,34,
+                44,45,46,34,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,47,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,48,21,49,50,
+                51,52,53,54,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,55,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,21,56,57,58,59,60,61,62,63,64,65,66,67,21,68,
+                69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,34,88,89,90,91,
+                21,21,21,92,93,94,34,34,34,34,34,34,34,34,34,95,21,21,21,21,96,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,21,21,97,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                21,21,98,99,34,34,100,101,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,102,21,21,21,21,103,104,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,105,
+                21,106,107,34,34,34,34,34,34,34,34,34,108,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,109,34,110,111,34,112,113,114,115,34,34,116,34,34,34,34,117,
+                118,119,120,34,34,34,34,121,122,123,34,34,34,34,124,34,125,126,127,128,125,129,130,131,
+                132,133,125,134,125,125,125,135,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,21,21,21,136,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,137,
+                138,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,139,21,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+                21,21,21,140,34,34,34,34,34,34,34,34,34,34,34,34,21,21,141,34,34,34,34,34,
+                21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,142,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,143,144,143,143,143,143,143,143,143,143,143,143,143,143,143,143,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+                34,34,34,34,34,34,34,34,
+            };
+            static constexpr uint8_t binary_properties_stage2[9280] = {
+                0,0,1,2,0,0,0,0,3,0,0,0,4,4,5,0,6,7,7,7,7,7,8,9,
+                10,11,11,11,11,11,12,0,0,13,0,0,0,0,0,0,3,0,14,15,0,16,17,0,
+                7,7,7,7,7,8,7,18,11,11,11,11,11,12,11,11,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,20,20,20,20,21,19,19,19,19,19,19,19,19,19,19,19,22,23,
+                24,25,26,27,22,25,28,22,19,25,23,25,26,20,29,28,30,31,32,20,20,20,20,21,
+                19,19,19,19,33,25,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,11,27,24,
+                20,18,19,19,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,34,11,11,
+                11,11,11,11,11,11,35,30,36,37,30,30,38,0,0,0,11,39,0,40,0,0,0,0,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,41,4,42,4,4,4,4,
+                4,4,4,4,19,43,44,45,0,46,8,47,26,7,7,7,48,7,7,11,11,11,11,11,
+                11,11,11,49,27,28,19,19,19,19,19,19,11,50,24,26,7,7,7,7,7,7,7,7,
+                7,7,7,7,11,11,11,11,11,11,11,11,11,11,11,11,19,19,19,19,19,19,19,19,
+                51,4,52,19,19,19,19,19,19,19,19,19,19,19,19,19,22,20,20,23,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,6,7,7,7,
+                7,7,7,7,7,8,53,0,11,11,11,11,11,11,11,11,11,11,39,0,54,4,4,4,
+                4,4,4,4,4,4,4,55,56,55,0,0,30,30,30,30,30,30,57,58,57,0,0,0,
+                0,0,0,0,4,4,59,60,30,30,30,30,30,30,30,30,30,30,61,4,4,4,4,4,
+                4,4,5,37,62,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,63,4,64,4,65,66,67,4,4,67,68,0,0,0,0,69,30,30,30,
+                30,30,30,30,4,4,4,4,4,4,59,70,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,71,4,4,72,0,0,0,4,4,67,30,30,30,30,30,
+                30,30,61,4,4,38,73,74,30,30,30,30,30,71,75,4,4,76,76,5,0,0,0,0,
+                30,30,30,30,30,30,76,0,30,30,57,0,30,30,30,30,30,30,70,57,0,0,4,4,
+                30,30,30,30,30,30,30,30,30,30,71,4,4,4,4,4,55,4,4,4,4,4,4,4,
+                4,30,30,30,30,30,30,30,30,30,30,30,30,30,71,77,4,4,4,4,76,4,30,30,
+                71,78,4,4,70,30,30,30,76,70,30,68,68,30,30,30,30,30,79,30,40,37,38,77,
+                4,64,64,80,0,9,0,81,71,78,4,4,38,0,0,82,54,70,57,58,68,30,30,30,
+                30,30,79,30,79,83,38,66,59,9,64,5,74,0,70,40,0,78,4,4,67,84,0,0,
+                54,70,30,81,81,30,30,30,30,30,79,30,79,70,38,77,4,55,55,5,85,0,0,0,
+                71,78,4,4,0,0,63,4,54,70,30,68,68,30,30,30,30,30,79,30,79,70,38,77,
+                4,64,64,5,0,54,0,81,71,78,4,4,53,0,0,0,86,70,57,37,79,38,83,79,
+                58,85,57,37,30,30,38,78,59,78,66,5,85,9,0,0,0,78,4,4,0,0,0,0,
+                4,62,30,79,79,30,30,30,30,30,79,30,30,30,38,77,4,66,66,5,0,56,57,53,
+                71,78,4,4,0,0,0,0,76,70,30,79,79,30,30,30,30,30,79,30,30,70,38,77,
+                4,66,66,5,0,56,0,83,71,78,4,4,83,0,0,0,4,30,30,79,79,30,30,30,
+                30,30,30,30,30,30,61,77,4,66,66,80,0,61,0,58,71,78,4,4,0,0,37,30,
+                54,70,30,30,30,57,37,30,30,30,30,30,81,30,30,53,30,57,87,9,4,88,4,4,
+                0,78,4,4,78,0,0,0,70,30,30,30,30,30,30,30,30,30,30,30,89,4,59,0,
+                30,61,4,59,4,4,5,0,0,0,0,0,0,0,0,0,83,79,57,30,30,30,30,30,
+                30,90,30,30,89,4,4,72,30,40,4,5,4,4,5,30,0,0,0,0,0,0,0,0,
+                85,0,0,0,0,0,5,0,4,4,5,0,0,91,74,78,30,30,70,30,30,30,30,30,
+                30,30,30,85,54,4,4,4,4,66,30,76,4,4,54,4,4,4,4,4,4,4,4,92,
+                0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,61,4,4,4,4,93,4,4,5,0,30,71,67,71,77,65,4,67,76,62,30,30,
+                71,4,4,75,4,4,4,5,7,7,7,7,7,7,7,7,7,48,0,94,11,11,11,11,
+                11,11,11,11,11,11,12,34,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,95,96,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,79,38,30,57,79,38,
+                30,30,30,30,30,30,30,30,30,30,79,38,30,30,30,30,30,30,30,30,79,38,30,57,
+                79,38,30,30,30,57,30,30,30,30,30,30,30,30,30,30,30,30,30,30,79,38,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,57,54,0,0,54,4,5,0,0,0,
+                30,30,30,30,0,0,0,0,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+                7,7,7,7,7,97,11,36,70,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,68,30,30,30,30,
+                98,30,30,30,30,30,57,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,57,37,30,30,85,0,30,30,30,30,71,5,0,58,30,30,30,30,71,92,0,0,
+                30,30,30,30,71,0,0,0,30,30,30,79,99,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,100,4,4,4,4,4,4,4,58,0,84,4,4,5,0,0,0,0,0,
+                0,0,101,102,4,4,5,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,85,0,30,30,30,30,30,30,30,30,30,30,103,0,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,0,30,30,30,30,30,30,30,57,
+                4,4,4,0,4,4,4,0,0,78,4,4,30,30,30,30,30,30,30,38,30,85,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,0,30,30,30,30,30,30,38,0,4,4,59,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,61,4,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,76,4,59,4,4,4,4,4,4,4,64,4,4,5,0,4,4,5,0,
+                0,58,0,0,4,4,4,55,4,4,4,59,0,0,0,0,0,0,0,0,0,0,0,0,
+                4,62,30,30,30,30,30,30,30,30,30,30,30,4,4,4,4,62,30,85,4,4,5,0,
+                0,0,9,4,4,0,0,0,93,30,30,30,30,30,30,30,76,4,4,67,4,4,67,30,
+                30,30,30,30,30,30,30,30,30,71,4,4,4,0,0,0,30,30,30,30,30,30,30,30,
+                30,4,4,4,4,4,0,0,4,4,5,70,4,4,67,30,30,30,30,30,30,30,30,38,
+                11,11,39,0,7,7,7,7,7,7,7,7,7,7,8,6,0,0,0,0,59,4,4,4,
+                4,4,62,69,30,65,80,0,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+                11,11,11,11,11,11,11,11,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,28,11,21,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,11,11,7,7,11,36,7,97,
+                11,11,7,7,11,11,7,7,11,36,7,97,11,11,104,104,11,11,7,7,11,11,11,36,
+                11,11,30,30,11,11,30,30,11,11,30,30,11,105,7,106,107,105,7,85,11,107,7,0,
+                11,11,7,108,107,105,7,85,109,109,110,111,0,0,0,0,0,0,112,113,0,0,0,114,
+                92,0,115,0,0,92,0,116,111,111,111,111,117,0,0,118,0,0,0,0,11,11,11,39,
+                0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,92,74,54,4,4,92,0,0,0,
+                119,120,121,122,18,94,123,97,124,125,47,126,7,35,127,27,0,128,36,17,0,0,0,0,
+                7,7,7,7,11,11,11,11,129,35,85,0,0,130,131,0,0,0,132,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,134,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,135,0,0,0,0,0,0,136,130,130,0,137,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,139,139,
+                140,139,139,139,141,141,141,141,141,141,142,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,133,0,0,124,0,0,134,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,135,137,130,143,130,130,137,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,131,0,0,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,131,130,130,137,144,0,115,115,0,134,0,135,134,0,0,0,145,0,144,135,143,0,0,
+                135,130,0,0,0,0,0,0,0,0,0,0,0,136,0,0,115,0,0,0,134,0,0,135,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,136,0,0,0,0,135,134,0,0,0,0,0,0,0,0,
+                0,0,0,0,134,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                7,7,7,7,7,7,7,7,7,7,7,7,11,11,11,11,11,11,11,11,11,11,11,11,
+                25,146,20,26,19,23,11,27,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+                19,19,19,19,19,19,19,19,19,39,120,147,148,0,0,0,11,11,11,11,11,11,11,11,
+                11,149,0,117,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,58,0,0,0,9,
+                30,30,30,30,30,57,0,0,30,57,30,57,30,57,30,57,30,57,30,57,30,57,30,57,
+                4,4,4,4,4,4,4,4,3,70,0,0,0,0,0,0,70,30,71,4,150,38,30,151,
+                70,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,57,56,70,
+                70,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,57,30,
+                0,70,30,30,30,30,30,30,30,30,30,30,70,30,30,30,30,30,30,30,30,30,30,30,
+                30,96,30,30,30,30,30,30,30,30,30,57,0,0,0,0,30,30,30,30,30,30,30,30,
+                0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,135,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,85,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,38,30,30,30,85,30,30,30,30,
+                4,4,67,0,0,0,0,0,19,19,19,19,19,19,19,19,19,19,19,152,0,4,4,153,
+                19,19,19,19,19,19,19,154,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,5,0,0,0,0,0,0,0,0,58,30,30,52,19,19,19,21,19,19,19,
+                19,19,19,19,19,19,19,19,19,19,19,19,11,11,20,24,19,19,155,156,19,21,19,19,
+                19,19,25,18,7,19,19,19,19,7,157,0,158,159,160,0,0,0,0,0,37,161,162,30,
+                163,163,61,30,30,30,30,30,61,4,0,92,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,0,0,0,67,30,30,30,30,30,30,30,30,30,30,30,30,4,4,4,
+                4,5,0,0,4,4,5,0,4,4,4,4,67,30,58,164,4,4,67,30,30,30,30,30,
+                30,71,4,5,30,30,30,30,30,61,4,4,4,0,0,0,30,30,30,30,30,30,30,85,
+                4,30,30,30,30,30,30,30,30,30,30,30,61,4,4,4,92,0,0,58,4,4,5,0,
+                30,69,30,30,4,4,67,57,30,30,30,30,30,30,30,30,30,30,76,4,4,59,0,0,
+                61,30,30,5,4,4,5,0,30,30,30,30,30,57,165,67,30,30,30,30,30,30,30,30,
+                30,30,30,30,77,65,62,71,103,0,0,0,0,0,58,38,30,30,61,4,37,166,0,0,
+                70,57,70,57,70,57,0,0,30,57,30,57,11,11,11,11,11,11,11,11,11,11,12,11,
+                11,11,167,0,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+                30,30,30,30,30,30,30,30,61,4,59,5,4,4,5,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,0,0,0,30,30,30,30,30,57,58,30,30,30,30,30,
+                30,30,30,30,30,30,30,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,38,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,0,0,0,0,0,0,0,0,
+                11,12,0,0,118,11,0,168,30,30,79,30,30,57,30,40,81,79,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,0,0,
+                0,0,0,0,58,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,
+                0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,37,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,0,0,0,0,0,0,0,0,0,0,30,30,38,0,
+                169,169,169,169,0,0,0,0,4,4,4,4,9,92,0,0,0,0,0,54,0,0,0,0,
+                0,0,0,0,90,58,90,90,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,170,0,0,0,0,4,4,5,0,
+                6,7,7,7,7,7,8,9,10,11,11,11,11,11,12,0,0,37,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,71,96,30,30,30,30,30,30,57,37,30,37,30,37,30,37,85,
+                0,0,0,0,111,111,60,0,30,30,30,70,30,30,30,30,30,57,30,30,30,30,57,81,
+                30,30,30,38,30,30,30,38,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,57,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,85,30,30,30,30,30,30,30,30,30,30,30,30,85,0,0,0,
+                92,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,0,0,0,70,30,30,30,30,
+                30,30,57,0,30,30,30,30,30,30,30,30,30,71,59,0,30,30,30,30,30,30,30,38,
+                30,30,30,30,30,30,30,30,30,0,30,30,70,38,0,0,0,0,0,0,0,0,0,0,
+                7,7,7,7,7,7,7,7,7,7,11,11,11,11,11,11,11,11,11,11,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,4,4,5,0,7,7,7,7,
+                7,7,7,7,7,0,11,11,11,11,11,11,11,11,11,0,30,30,30,30,30,30,30,30,
+                30,30,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,0,0,0,7,7,8,7,
+                7,7,8,7,8,171,11,11,149,11,11,11,149,11,149,39,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,57,0,0,
+                30,30,30,30,30,38,0,0,30,30,0,0,0,0,0,0,172,149,11,11,11,11,11,11,
+                11,11,11,11,105,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,38,79,30,30,30,30,30,30,30,30,30,30,81,85,68,30,30,30,30,30,38,0,0,
+                30,30,30,30,30,57,0,0,30,30,30,30,30,30,30,57,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,57,38,0,0,30,30,30,30,30,38,0,0,
+                30,30,30,30,30,30,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,37,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,76,56,0,4,30,70,70,30,30,30,30,30,30,38,59,9,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,85,30,30,30,30,30,30,30,85,
+                0,0,0,0,0,0,0,0,30,30,70,30,30,30,30,30,30,166,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,0,30,30,30,30,30,38,0,0,
+                30,30,30,30,57,0,0,0,30,30,30,30,38,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,85,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                7,7,7,7,7,7,7,7,7,7,7,7,8,0,0,0,11,11,11,11,11,11,11,11,
+                11,11,11,11,12,0,0,0,30,30,30,30,30,30,30,30,30,4,0,0,4,4,5,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,173,92,38,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,85,
+                0,58,0,0,30,30,30,30,30,71,4,4,92,0,0,0,0,0,0,0,30,30,30,30,
+                71,5,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,85,0,0,0,0,0,0,
+                30,30,30,30,30,57,0,0,93,30,30,30,30,30,30,30,30,30,30,30,30,30,4,4,
+                4,59,0,0,0,0,0,0,0,78,4,4,65,72,0,9,93,30,30,30,30,30,30,30,
+                30,30,30,30,4,4,59,0,87,0,0,0,30,30,30,30,30,30,85,0,4,4,5,0,
+                93,30,30,30,30,30,30,30,30,61,4,4,4,66,4,4,0,174,0,0,30,30,30,30,
+                30,30,30,30,61,73,0,0,93,30,30,30,30,30,30,30,30,30,30,30,61,4,4,4,
+                62,85,54,66,4,4,80,85,0,0,0,0,0,0,0,0,30,30,30,30,81,30,30,30,
+                30,30,30,4,4,4,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,57,79,81,30,30,30,81,30,30,85,0,30,30,30,30,30,30,30,30,30,30,30,61,
+                4,4,59,0,4,4,5,0,4,70,30,68,68,30,30,30,30,30,79,30,79,70,173,77,
+                4,64,64,5,85,9,0,70,71,78,4,92,4,92,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,76,4,4,4,93,57,0,4,4,5,86,
+                38,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,4,4,4,4,
+                4,81,0,0,4,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,61,4,5,4,4,92,0,0,0,0,0,30,5,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,4,4,4,4,
+                92,85,0,0,4,4,5,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,61,4,4,4,85,0,4,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,57,54,4,4,4,0,4,4,5,0,30,57,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,4,4,4,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,7,7,7,7,7,7,7,7,11,11,11,11,11,11,11,11,
+                4,4,5,0,0,0,0,58,30,57,53,30,30,83,30,30,30,30,30,30,4,55,64,93,
+                77,0,0,0,4,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,37,30,30,30,30,30,30,30,30,30,76,4,78,4,175,92,0,0,0,0,0,0,
+                76,4,93,30,30,30,30,30,30,30,30,30,61,4,75,59,0,9,0,0,76,4,4,30,
+                30,30,30,30,30,30,30,30,30,30,71,4,4,4,5,53,0,0,0,0,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,85,0,30,30,79,30,30,30,30,30,
+                30,30,30,61,4,59,4,4,85,0,0,0,4,4,5,0,0,0,0,0,37,30,30,30,
+                30,30,30,30,78,4,4,4,4,4,54,4,4,59,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,57,81,30,30,30,30,30,30,30,30,30,76,59,87,55,
+                4,75,0,0,4,4,5,0,30,81,79,30,30,30,30,30,30,30,71,59,55,4,85,0,
+                4,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,61,59,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,57,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,85,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,57,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,85,0,
+                30,30,30,30,30,30,30,57,4,4,5,0,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,57,4,4,5,0,30,30,30,30,30,30,30,38,4,92,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,4,59,0,0,30,0,0,0,4,4,5,0,
+                58,30,30,30,30,30,0,70,30,30,30,30,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,7,7,7,7,7,7,7,7,11,11,11,11,11,11,11,11,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,57,9,76,4,4,4,4,4,4,4,4,4,4,4,4,4,0,9,93,30,30,30,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,92,0,0,5,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,38,0,0,
+                0,0,0,0,0,0,0,0,30,30,85,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,30,70,30,83,30,30,30,30,30,30,30,30,
+                57,0,0,0,0,0,0,0,0,0,0,0,57,0,0,0,0,30,0,0,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,57,0,30,30,30,85,30,30,85,0,30,30,38,56,111,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,
+                4,4,4,5,4,4,4,4,4,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,54,5,54,176,111,177,4,59,54,4,0,0,0,0,0,
+                0,0,78,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,92,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,7,7,7,7,7,122,11,
+                11,11,11,11,11,7,7,7,7,7,7,122,11,105,11,11,11,11,7,7,7,7,7,7,
+                122,11,11,11,11,11,11,47,119,178,6,47,7,122,149,10,11,10,11,11,7,7,7,7,
+                7,7,122,11,11,11,11,11,11,48,8,6,7,47,7,179,11,11,11,11,11,11,48,8,
+                7,125,180,7,179,11,11,11,11,11,11,7,7,7,7,7,7,122,11,11,11,11,11,11,
+                7,7,7,7,7,7,122,11,11,11,11,11,11,7,7,7,7,7,7,122,11,11,11,11,
+                11,11,7,7,7,7,7,7,122,11,11,11,11,11,11,7,7,7,7,7,7,122,11,11,
+                11,11,11,11,7,7,7,7,7,7,122,11,11,11,11,11,11,36,7,7,7,7,7,7,
+                179,11,11,11,11,11,12,11,27,7,7,7,7,7,8,11,11,11,11,11,11,105,11,7,
+                7,7,7,7,7,179,11,11,11,11,11,12,11,27,7,7,7,7,7,8,11,11,11,11,
+                11,11,105,11,7,7,7,7,7,7,179,11,11,11,11,11,12,11,21,78,4,4,4,4,
+                4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,59,9,4,
+                4,4,4,4,4,4,4,4,4,4,4,92,0,74,0,0,0,92,0,0,0,0,9,4,
+                54,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                11,11,181,11,11,11,11,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,59,4,4,4,4,64,4,
+                55,66,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,85,4,93,30,38,
+                4,4,5,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,182,0,0,0,0,
+                30,30,30,30,30,30,30,30,30,30,30,4,4,4,5,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                30,57,30,83,30,30,30,57,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,85,0,0,4,59,0,0,0,0,0,0,0,0,0,0,
+                7,7,7,7,7,7,7,7,122,11,11,11,11,11,11,11,11,4,93,0,4,4,5,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,70,30,30,30,30,30,30,
+                83,68,70,30,57,30,90,0,73,58,90,70,83,68,90,90,83,68,57,30,57,30,70,40,
+                30,30,81,30,30,30,30,0,70,70,81,30,30,30,30,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                0,0,0,136,0,0,0,0,0,0,0,135,139,139,139,139,139,139,183,0,139,139,139,139,
+                139,139,183,130,184,139,139,185,139,139,183,124,136,130,137,0,0,0,0,136,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,131,0,0,0,0,0,0,136,130,130,130,0,0,124,0,
+                0,0,0,135,133,130,137,130,0,0,136,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,137,0,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,131,0,133,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,0,0,0,0,0,0,0,0,0,0,0,0,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,130,130,130,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,136,130,130,130,130,130,130,130,130,130,130,
+                0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,130,0,0,133,130,
+                0,0,0,0,0,0,0,0,0,0,130,130,0,0,0,0,0,0,0,133,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,0,0,0,130,130,130,130,130,
+                130,130,130,130,130,130,137,130,130,143,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,5,0,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+                130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,131,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,30,30,85,0,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,38,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,38,0,0,0,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,85,0,0,0,0,0,0,0,
+                30,30,30,30,30,30,30,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,30,30,30,30,30,30,30,
+                30,30,30,30,30,30,30,30,30,30,57,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+                111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+                111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,111,
+                169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+                169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,169,
+                169,169,169,169,169,169,169,169,169,169,169,169,111,111,111,111,
+            };
+            static constexpr uint8_t binary_properties_stage3[744] = {
+                0,0,0,0,0,1,1,1,1,1,0,0,1,0,0,0,16,16,16,16,16,16,0,0,
+                0,26,26,26,26,26,26,26,26,26,26,0,0,0,0,16,0,28,28,28,28,28,28,28,
+                28,28,28,0,0,1,0,0,0,64,28,0,0,32,64,0,0,28,0,16,0,0,28,0,
+                26,26,26,28,26,28,26,28,28,26,28,26,28,28,26,28,26,26,28,26,28,26,28,28,
+                28,26,26,28,26,28,26,26,28,26,26,26,28,28,26,26,26,28,28,28,26,28,28,24,
+                24,24,24,24,26,24,28,26,24,28,26,24,28,26,24,28,24,28,28,28,28,24,24,24,
+                28,28,0,0,0,0,24,24,24,24,0,0,28,0,0,0,24,0,24,0,16,20,16,16,
+                16,16,16,48,24,0,26,28,0,0,4,28,28,28,0,26,0,0,26,16,26,0,26,26,
+                26,26,0,26,28,28,28,26,26,28,0,26,26,28,0,16,0,0,26,28,0,24,0,0,
+                0,16,16,16,16,16,0,16,0,16,16,0,24,24,24,0,0,0,0,24,16,16,16,0,
+                32,0,0,0,24,24,24,16,16,24,24,24,0,24,16,16,16,0,0,16,16,24,24,16,
+                16,0,16,16,16,16,24,24,24,0,0,24,24,16,24,24,0,24,24,24,24,24,16,16,
+                16,24,0,0,0,0,24,0,0,16,0,0,16,16,24,16,24,16,16,16,16,24,16,16,
+                0,0,16,16,24,0,24,24,16,16,24,0,24,24,0,24,24,0,16,0,0,24,24,0,
+                24,16,0,0,24,0,0,0,0,0,16,24,0,0,16,0,16,0,16,0,24,16,24,16,
+                0,24,0,24,0,16,0,16,16,0,0,0,16,16,16,24,0,26,0,0,24,24,24,56,
+                56,24,24,24,26,26,0,0,1,24,24,24,24,0,16,16,48,48,16,16,0,0,0,48,
+                48,48,32,48,24,16,24,0,0,26,0,26,28,0,28,28,24,0,28,0,0,0,28,28,
+                26,0,0,0,1,1,1,1,1,1,1,32,32,32,32,32,1,1,32,32,32,32,32,1,
+                64,0,0,16,0,64,0,0,0,0,0,1,0,28,0,0,0,0,0,28,0,0,26,0,
+                0,0,0,26,0,0,28,26,26,26,28,28,24,26,26,26,0,0,64,0,26,0,26,0,
+                26,26,24,28,24,92,0,0,0,26,28,28,24,24,24,26,64,64,64,64,64,64,0,0,
+                0,64,64,0,0,0,64,64,64,0,0,0,0,0,0,64,0,64,64,64,64,64,64,0,
+                0,0,2,2,2,2,2,2,2,2,66,2,4,4,4,4,4,4,0,0,64,64,0,64,
+                64,0,64,0,64,0,0,64,26,28,28,26,28,26,28,16,16,16,26,28,28,28,0,28,
+                64,24,24,24,24,64,0,0,26,28,24,16,16,16,0,24,28,28,16,16,24,0,0,26,
+                28,26,28,24,28,26,28,0,26,28,0,28,0,28,26,28,26,28,0,0,24,26,28,24,
+                28,28,28,24,24,24,16,24,0,24,24,16,0,0,24,16,24,16,16,0,28,24,0,0,
+                0,24,16,24,48,48,48,48,24,0,0,32,26,26,0,28,28,24,24,28,24,24,0,16,
+                24,16,16,24,16,24,0,24,16,16,16,32,32,32,32,16,0,26,26,0,26,0,28,28,
+                0,0,26,26,28,28,24,28,24,24,16,0,2,2,0,0,66,66,2,2,2,2,66,66,
+            };
+            static constexpr uint8_t grapheme_break_stage1[2176] = {
+                0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,10,15,16,17,18,19,20,21,10,
+                22,23,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,24,25,26,27,28,29,30,31,32,33,27,28,29,
+                30,31,32,33,27,28,29,30,31,32,33,34,35,35,35,35,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,36,10,37,38,39,10,10,10,40,41,42,43,44,45,46,47,48,49,50,
+                10,10,10,10,10,10,10,10,10,10,51,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,52,10,53,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,54,10,10,10,10,10,10,10,10,55,56,57,10,10,10,58,10,10,
+                59,60,10,10,61,10,10,10,62,63,64,65,66,67,68,69,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,70,35,35,35,35,35,35,35,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+                10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+            };
+            static constexpr uint8_t grapheme_break_stage2[4544] = {
+                0,1,0,0,2,2,2,2,2,2,2,2,2,2,2,3,0,0,0,0,2,4,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                6,7,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,8,5,5,5,5,9,10,2,2,2,2,2,2,2,
+                11,2,5,12,2,2,2,2,2,6,5,5,2,2,13,2,2,2,2,2,2,2,2,2,
+                2,2,14,15,16,17,2,2,2,18,19,2,2,2,5,5,5,20,2,2,2,2,2,2,
+                2,2,2,2,14,5,13,2,2,2,2,2,2,6,21,22,2,2,14,23,24,25,2,2,
+                2,2,2,26,2,2,2,2,2,2,27,5,2,2,2,2,2,28,5,5,29,5,5,5,
+                30,2,2,2,2,2,2,31,32,33,8,2,34,2,2,2,35,2,2,2,2,2,2,36,
+                37,38,39,2,34,2,2,40,41,2,2,2,2,2,2,42,43,44,19,2,2,2,45,2,
+                41,2,2,2,2,2,2,42,46,47,2,2,34,2,2,28,35,2,2,2,2,2,2,48,
+                37,38,49,2,34,2,2,2,50,2,2,2,2,2,2,51,52,53,39,2,2,2,2,2,
+                54,2,2,2,2,2,2,48,55,17,56,2,34,2,2,2,35,2,2,2,2,2,2,57,
+                58,59,56,2,34,2,2,2,60,2,2,2,2,2,2,61,62,63,39,2,34,2,2,2,
+                35,2,2,2,2,2,2,2,2,64,65,66,2,2,67,2,2,2,2,2,2,2,68,20,
+                39,69,2,2,2,2,2,2,2,2,2,2,2,2,68,70,2,71,2,2,2,2,2,2,
+                2,2,2,7,2,2,72,73,2,2,2,2,2,2,8,74,75,49,5,8,5,5,5,70,
+                40,2,2,2,2,2,2,2,2,2,2,2,2,49,76,77,2,2,78,79,13,2,80,2,
+                81,22,2,22,2,2,2,2,2,2,2,2,2,2,2,2,82,82,82,82,82,82,82,82,
+                82,82,82,82,83,83,83,83,83,83,83,83,83,84,84,84,84,84,84,84,84,84,84,84,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,49,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,85,2,2,2,86,2,
+                2,2,34,2,2,2,34,2,2,2,2,2,2,2,87,88,89,32,21,22,2,2,2,2,
+                2,90,2,2,2,2,2,2,2,2,2,2,2,2,2,2,56,2,2,2,2,19,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,91,92,93,94,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,39,95,2,2,2,2,
+                2,2,96,69,97,98,99,16,2,2,2,2,2,2,5,5,5,69,2,2,2,2,2,2,
+                100,2,2,2,2,2,101,102,103,2,2,2,2,6,21,2,104,2,2,2,105,106,2,2,
+                2,2,2,2,51,107,60,2,2,2,2,2,108,109,110,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,111,5,76,112,113,7,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,5,5,5,5,
+                2,114,2,2,2,115,2,116,2,117,2,2,0,0,2,2,2,2,2,2,2,2,2,2,
+                2,2,5,5,5,5,13,2,2,2,2,2,118,2,2,117,2,2,2,2,2,2,2,2,
+                2,2,119,120,2,121,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,122,2,123,2,2,2,2,2,2,2,2,2,2,2,123,2,2,2,2,2,2,
+                2,124,2,2,2,125,126,127,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,118,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,122,128,2,123,2,2,2,2,2,2,129,
+                130,131,132,131,131,131,131,131,131,131,131,131,131,131,131,131,133,2,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,133,131,134,135,117,123,136,2,137,138,139,2,140,2,2,2,
+                2,2,141,2,117,2,123,124,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,142,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,141,2,2,136,2,2,2,2,
+                2,2,143,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,39,7,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,39,
+                2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,2,2,2,2,2,28,123,135,
+                2,2,2,2,2,2,2,2,2,2,2,144,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,124,117,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,39,111,71,2,2,2,14,2,2,2,2,
+                2,2,2,2,2,2,7,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,145,146,2,2,147,148,2,2,
+                2,2,2,2,2,2,2,2,149,2,2,2,2,2,108,150,151,2,2,2,5,5,7,39,
+                2,2,2,2,14,71,2,2,39,5,60,2,82,82,82,152,30,2,2,2,2,2,153,154,
+                155,2,2,2,22,2,2,2,2,2,2,2,2,156,157,2,146,158,2,2,2,2,2,148,
+                2,2,2,2,2,2,159,160,19,2,2,2,2,161,162,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,163,164,2,2,
+                165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,
+                167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,
+                166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,
+                166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,
+                166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,
+                166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,
+                166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,
+                165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,
+                167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,
+                166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,
+                166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,
+                166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,
+                166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,
+                166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,
+                165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,
+                167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,
+                166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,
+                166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,
+                166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,
+                166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,167,
+                166,166,166,165,166,166,167,166,166,166,165,166,166,167,166,166,166,165,166,166,168,2,83,83,
+                169,170,84,84,84,84,84,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,40,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,2,2,5,5,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,3,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,2,2,2,2,
+                2,2,2,2,2,2,0,172,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,22,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,13,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,20,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,173,101,2,2,2,2,2,174,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,56,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,101,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,175,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,14,5,13,2,2,2,2,2,
+                176,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,177,2,2,2,2,2,2,5,
+                69,2,2,2,2,2,178,39,104,2,2,2,2,2,179,180,50,181,2,2,2,2,2,2,
+                20,2,2,2,39,182,70,2,183,2,2,2,2,2,146,2,104,2,2,2,2,2,184,74,
+                185,186,2,2,2,2,2,2,2,2,2,2,2,187,188,40,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,39,99,20,2,2,60,2,2,2,2,2,2,61,
+                189,190,39,2,191,70,70,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,192,5,193,2,2,40,2,2,2,2,2,2,2,2,2,2,194,195,
+                196,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,39,197,198,13,2,2,199,2,2,2,2,2,2,2,2,2,2,99,200,
+                13,2,2,2,2,2,2,2,2,2,2,2,2,201,202,2,2,2,2,2,2,2,2,2,
+                2,2,2,49,203,21,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,187,5,204,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,205,206,
+                207,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,208,209,210,2,2,2,
+                8,20,2,2,2,2,6,211,39,2,156,94,2,2,2,2,212,213,74,7,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,214,69,202,
+                2,2,2,2,2,2,2,2,2,2,28,5,5,215,216,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,217,218,219,2,2,2,2,2,2,2,2,220,221,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,222,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,0,223,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,70,2,
+                2,2,2,2,2,2,69,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,39,224,150,150,150,150,150,150,39,20,2,2,2,2,2,2,2,2,2,148,2,149,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,56,172,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                5,5,5,5,5,71,5,5,69,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,225,226,227,228,229,21,2,2,2,176,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,230,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,5,5,5,5,5,5,69,6,
+                5,5,5,5,5,70,22,2,148,2,2,6,8,5,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,69,5,5,231,232,20,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,69,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,40,2,2,
+                2,2,2,2,2,101,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,69,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,101,20,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,2,141,2,2,2,124,2,2,
+                2,2,2,2,2,119,120,233,2,128,125,127,2,141,131,131,131,131,131,131,234,235,235,235,
+                125,131,2,118,2,124,236,132,2,125,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,237,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,133,233,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,2,2,2,2,2,2,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,119,131,2,2,2,2,2,2,2,2,2,2,141,131,131,131,131,131,
+                2,119,2,2,2,2,2,2,2,131,2,236,2,2,2,2,2,131,2,2,2,233,131,131,
+                131,131,131,131,131,131,131,131,2,119,131,131,131,131,131,132,130,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,
+                131,131,131,131,131,131,131,131,131,131,131,131,131,131,131,133,0,0,0,0,5,5,5,5,
+                5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+                5,5,5,5,5,5,0,0,
+            };
+            static constexpr uint8_t grapheme_break_stage3[1904] = {
+                3,3,3,3,3,3,3,3,3,3,2,3,3,1,3,3,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,3,0,14,0,0,0,3,14,0,4,4,4,4,4,4,4,4,
+                0,0,0,4,4,4,4,4,4,4,0,0,0,0,0,0,0,4,4,4,4,4,4,4,
+                4,4,4,4,4,4,0,4,0,4,4,0,4,4,0,4,7,7,7,7,7,7,0,0,
+                4,4,4,0,3,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,
+                4,4,4,4,4,7,0,4,4,4,4,4,4,0,0,4,4,0,4,4,4,4,0,0,
+                0,0,0,0,0,0,0,7,0,4,0,0,0,0,0,0,4,4,4,0,0,0,0,0,
+                4,4,4,4,0,0,0,0,0,0,0,0,0,4,0,0,4,4,0,4,4,4,4,4,
+                4,4,4,4,0,4,4,4,0,4,4,4,4,4,0,0,0,4,4,4,0,0,0,0,
+                7,7,0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,7,4,4,4,4,4,
+                4,4,4,8,0,0,0,0,0,0,4,8,4,0,8,8,8,4,4,4,4,4,4,4,
+                4,8,8,8,8,4,8,8,0,0,4,4,0,0,0,0,0,4,8,8,0,0,0,0,
+                0,0,0,0,4,0,4,8,8,4,4,4,4,0,0,8,8,0,0,8,8,4,0,0,
+                0,0,0,0,0,0,0,4,0,0,0,0,0,0,4,0,0,4,4,8,0,0,0,0,
+                0,0,0,0,4,0,8,8,8,4,4,0,0,0,0,4,4,0,0,4,4,4,0,0,
+                4,4,0,0,0,4,0,0,8,4,4,4,4,4,0,4,4,8,0,8,8,4,0,0,
+                0,0,0,0,4,0,4,4,0,0,0,0,0,4,4,4,0,0,4,0,0,0,0,0,
+                0,0,0,0,0,0,4,8,4,8,8,0,0,0,8,8,8,0,8,8,8,4,0,0,
+                4,8,8,8,4,0,0,0,4,8,8,8,8,0,4,4,0,0,0,0,0,4,4,0,
+                0,0,0,0,4,0,8,4,8,8,4,8,8,0,4,8,8,0,8,8,4,4,0,0,
+                4,4,8,8,0,0,0,0,0,0,0,4,4,0,4,8,8,4,4,4,4,0,8,8,
+                8,0,8,8,8,4,7,0,0,0,4,0,0,0,0,4,8,8,4,4,4,0,4,0,
+                8,8,8,8,8,8,8,4,0,0,8,8,0,0,0,0,0,4,0,8,4,4,4,4,
+                4,4,4,4,4,4,4,0,4,4,4,4,4,0,0,0,4,4,4,4,4,4,0,0,
+                0,0,0,0,0,4,0,4,0,4,0,0,0,0,8,8,4,4,4,4,4,4,4,8,
+                4,4,4,4,4,0,4,4,4,8,4,4,4,4,4,4,0,4,4,8,8,4,4,0,
+                0,0,0,0,0,0,8,8,4,4,0,0,0,0,4,4,0,4,4,4,4,0,0,0,
+                0,0,4,0,8,4,4,0,9,9,9,9,9,9,9,9,10,10,10,10,10,10,10,10,
+                11,11,11,11,11,11,11,11,0,0,4,4,4,8,0,0,0,0,4,4,8,0,0,0,
+                0,0,0,0,4,4,8,4,4,4,4,4,4,4,8,8,8,8,8,8,8,8,4,8,
+                0,0,0,4,4,4,3,4,4,4,4,8,8,8,8,4,4,8,8,8,0,0,0,0,
+                8,8,4,8,8,8,8,8,8,4,4,4,0,0,0,0,4,8,8,4,0,0,0,0,
+                0,0,0,0,0,8,4,8,4,0,4,0,0,4,4,4,4,4,4,4,4,8,8,8,
+                8,8,8,4,4,4,4,4,4,4,4,4,8,0,0,0,0,0,0,0,4,4,4,4,
+                4,4,4,8,4,8,8,8,8,8,4,8,8,0,0,0,4,4,8,0,0,0,0,0,
+                0,8,4,4,4,4,8,8,4,4,8,4,4,4,0,0,4,4,8,8,8,4,8,4,
+                0,0,0,0,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,8,8,4,4,
+                4,4,4,0,4,4,4,4,4,0,0,0,0,4,0,0,0,0,0,0,4,0,0,8,
+                0,0,0,3,4,5,3,3,3,3,3,3,3,3,3,0,0,0,0,0,14,0,0,0,
+                0,14,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,14,14,14,14,
+                14,14,0,0,0,0,0,0,0,14,14,0,0,0,0,0,0,0,14,14,0,0,0,0,
+                14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,14,14,14,14,14,14,14,
+                14,14,14,14,0,0,0,0,14,14,14,0,0,0,0,0,0,0,0,0,0,0,14,0,
+                0,0,0,14,14,14,14,0,14,14,14,14,14,14,0,14,14,14,14,14,14,14,14,14,
+                14,14,14,0,14,14,14,14,14,14,14,14,14,14,0,0,14,14,14,0,14,0,14,0,
+                0,0,0,0,0,14,0,0,0,0,0,14,14,0,0,0,0,0,0,0,14,0,0,14,
+                0,0,0,0,14,0,14,0,0,0,0,14,14,14,0,14,0,0,0,14,14,14,14,14,
+                0,0,0,0,0,14,14,14,0,0,0,0,14,14,0,0,14,0,0,0,0,14,0,0,
+                0,4,4,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,0,4,0,0,0,0,
+                0,0,0,8,8,4,4,8,0,0,0,0,4,0,0,0,8,8,0,0,0,0,0,0,
+                8,8,8,8,8,8,8,8,8,8,8,8,4,4,0,0,9,9,9,9,9,0,0,0,
+                0,0,0,4,8,8,4,4,4,4,8,8,4,4,8,8,8,0,0,0,0,0,0,0,
+                0,4,4,4,4,4,4,8,8,4,4,8,8,4,4,0,0,0,0,0,4,8,0,0,
+                4,0,4,4,4,0,0,4,4,0,0,0,0,0,4,4,0,0,0,8,4,4,8,8,
+                0,0,0,0,0,8,4,0,0,0,0,8,8,4,8,8,4,8,8,0,8,4,0,0,
+                12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,
+                13,13,13,13,0,0,0,0,10,10,10,10,10,10,10,0,0,0,0,11,11,11,11,11,
+                11,11,11,11,0,0,0,0,3,3,3,3,0,0,0,0,0,4,4,4,0,4,4,0,
+                4,4,4,0,0,0,0,4,0,0,0,4,4,0,0,0,0,0,4,4,4,4,0,0,
+                8,4,8,0,0,0,0,0,4,0,0,4,4,0,0,0,8,8,8,4,4,4,4,8,
+                8,4,4,0,0,7,0,0,0,0,0,0,0,7,0,0,4,4,4,4,8,4,4,4,
+                0,0,0,0,0,8,8,0,0,0,0,8,8,8,4,4,8,0,7,7,0,0,0,0,
+                0,4,4,4,4,0,8,4,0,0,0,0,8,8,8,4,4,4,8,8,4,8,4,4,
+                4,8,8,8,8,0,0,8,8,0,0,8,8,8,0,0,0,0,8,8,0,0,4,4,
+                0,0,0,0,0,8,8,8,8,8,4,4,4,8,4,0,4,8,8,4,4,4,4,4,
+                4,8,4,8,8,4,8,4,4,8,4,4,0,0,0,0,8,8,4,4,4,4,0,0,
+                8,8,8,8,4,4,8,4,0,0,0,0,4,4,0,0,4,4,4,8,8,4,8,4,
+                0,0,0,4,8,4,8,8,4,4,4,4,4,4,8,4,0,0,4,4,4,4,8,4,
+                8,4,4,0,0,0,0,0,4,8,8,8,8,8,0,8,8,0,0,4,4,8,4,7,
+                8,7,8,4,0,0,0,0,0,8,8,8,4,4,4,4,0,0,4,4,8,8,8,8,
+                4,0,0,0,8,0,0,0,4,8,7,4,4,4,4,0,0,0,0,0,7,7,7,7,
+                7,7,4,4,4,4,4,4,0,0,0,0,0,0,0,8,0,8,4,4,4,4,4,4,
+                4,8,4,4,8,4,4,0,0,4,4,4,4,4,4,0,0,0,4,0,4,4,0,4,
+                4,4,4,4,4,4,7,4,0,0,8,8,8,8,8,0,4,4,0,8,8,4,8,4,
+                0,0,0,4,4,8,8,0,3,0,0,0,0,0,0,0,0,8,8,8,8,8,8,8,
+                0,0,0,0,0,4,8,4,4,4,0,0,0,8,4,4,4,4,4,3,3,3,3,3,
+                3,3,3,4,4,4,4,4,4,4,4,0,0,4,4,4,0,0,4,4,4,0,0,0,
+                4,0,0,4,4,4,4,4,4,4,0,4,4,0,4,4,0,0,0,0,0,0,14,14,
+                14,14,14,14,14,14,6,6,6,6,6,6,6,6,6,6,0,0,14,14,14,14,14,14,
+                14,14,14,4,4,4,4,4,
+            };
+            static constexpr uint8_t display_width_stage1[1088] = {
+                0,1,2,3,4,5,6,7,8,9,10,11,12,13,13,13,13,13,13,14,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,15,16,13,13,13,13,13,
+                13,13,13,13,13,17,18,18,18,18,18,18,18,18,19,20,21,18,22,23,24,25,26,27,
+                18,18,18,18,18,28,18,18,18,18,18,18,18,18,18,18,18,18,29,30,13,13,13,13,
+                13,31,13,32,18,18,18,18,18,18,18,33,34,18,18,35,18,18,18,36,37,18,38,18,
+                39,18,40,18,41,42,43,18,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,44,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+                13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,44,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,45,45,45,45,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+                18,18,18,18,18,18,18,18,
+            };
+            static constexpr uint8_t display_width_stage2[2944] = {
+                0,0,1,1,1,1,1,2,0,0,3,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,0,6,7,1,1,1,
+                8,9,1,1,10,0,1,11,1,1,1,1,1,12,13,1,2,14,1,0,15,1,1,1,
+                1,1,16,11,1,1,10,17,1,18,19,1,1,20,1,1,1,21,1,1,22,0,0,0,
+                23,1,1,24,25,26,27,1,14,1,1,28,29,1,27,30,31,1,1,28,32,14,1,33,
+                31,1,1,28,34,1,27,22,14,1,1,35,29,36,27,1,37,1,1,1,38,1,1,1,
+                39,1,1,40,41,36,27,1,14,1,1,35,42,1,27,1,43,1,1,44,29,1,27,1,
+                14,1,1,1,45,46,1,1,1,1,1,47,48,1,1,1,1,1,1,49,50,1,1,1,
+                1,51,1,52,1,1,1,53,54,55,0,56,57,1,1,1,1,1,58,59,1,60,11,61,
+                62,3,1,1,1,1,1,1,63,63,63,63,63,64,0,0,0,0,0,0,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,58,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,65,1,27,1,27,1,27,1,1,1,66,67,17,1,1,
+                10,1,1,1,1,1,1,1,36,1,68,1,1,1,1,1,1,1,69,70,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,71,1,1,1,72,73,74,1,1,1,0,75,1,1,1,
+                76,1,1,77,37,1,10,76,43,1,78,1,1,1,79,43,1,1,80,81,1,1,1,1,
+                1,1,1,1,1,82,83,84,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,10,1,85,1,1,1,0,1,1,1,1,1,1,0,0,11,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,86,87,1,1,1,1,1,1,1,1,1,1,1,88,89,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,90,1,91,1,1,92,93,1,94,1,95,96,90,97,98,99,100,
+                101,1,102,1,103,104,1,1,1,105,1,106,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,107,1,1,1,108,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,43,
+                1,1,1,1,1,1,1,2,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,
+                63,109,63,63,63,63,63,93,63,63,63,63,63,63,63,63,63,63,63,63,63,110,1,111,
+                63,63,112,113,114,63,63,63,63,115,63,63,63,63,63,63,116,63,63,114,63,63,117,63,
+                113,63,63,63,63,63,93,63,63,113,63,63,118,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,1,1,1,1,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,119,63,63,63,120,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,121,1,122,1,1,1,1,1,43,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,123,1,124,1,1,1,1,1,
+                1,1,1,1,125,1,0,126,1,1,127,1,128,43,63,119,23,1,1,129,1,1,130,1,
+                1,1,131,132,133,1,1,28,1,1,1,134,14,1,135,57,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,136,1,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,93,0,137,0,0,138,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,1,30,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,139,0,63,63,140,141,1,
+                1,1,1,1,1,1,1,2,114,63,63,63,63,63,142,1,1,1,11,1,1,1,120,138,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,1,
+                1,1,1,1,1,1,1,143,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                144,1,1,145,1,1,1,1,1,1,1,1,1,1,36,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,146,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,44,1,1,1,1,1,1,1,1,1,16,11,1,1,147,1,1,1,1,1,1,1,
+                14,1,1,148,149,1,1,150,43,1,1,151,152,1,1,1,23,1,153,154,1,1,1,155,
+                43,1,1,156,157,1,1,1,1,1,2,158,1,1,1,1,1,1,1,1,1,2,159,1,
+                43,1,1,44,11,1,160,154,1,1,1,1,1,1,1,1,1,1,1,148,46,30,1,1,
+                1,1,1,161,162,1,1,1,1,1,1,1,1,1,1,1,1,1,1,163,11,135,1,1,
+                1,1,1,164,11,1,1,1,1,1,165,166,1,1,1,1,1,58,167,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,2,168,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,169,155,1,1,1,1,1,1,1,1,170,11,1,171,1,1,172,173,174,1,1,
+                22,175,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,176,1,1,1,1,1,177,178,179,1,1,1,1,1,1,1,180,166,1,1,1,
+                1,181,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,182,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,183,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,154,1,1,1,149,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,2,1,1,1,2,23,1,1,1,1,184,185,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,118,63,63,63,63,63,63,63,63,63,63,63,63,63,110,1,1,
+                186,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,187,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,188,1,1,188,189,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,111,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,190,76,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,191,0,149,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,192,193,194,1,195,1,1,1,1,1,
+                1,1,1,1,65,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,137,0,0,56,130,
+                196,10,5,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                197,198,199,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,149,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,30,1,1,1,80,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,149,1,1,1,1,1,1,200,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,98,1,1,1,1,1,1,1,1,1,1,1,94,1,1,1,
+                1,1,1,1,1,1,1,1,201,202,1,1,1,1,1,1,188,63,63,111,186,185,110,1,
+                1,1,1,1,1,1,1,1,63,63,203,204,63,63,63,205,63,93,63,63,206,93,63,207,
+                63,63,63,113,208,63,63,63,63,63,63,63,63,63,63,209,63,63,63,210,211,63,118,99,
+                1,212,98,1,1,1,1,213,63,63,63,63,63,1,1,1,63,63,63,63,214,215,107,216,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,111,142,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,217,63,63,218,204,63,63,63,63,63,63,63,63,63,63,63,
+                1,1,1,1,1,1,1,219,120,63,119,220,110,139,118,120,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,
+                63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,210,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            };
+            static constexpr uint8_t display_width_stage3[3536] = {
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,0,0,0,0,0,
+                0,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,1,0,0,1,0,
+                1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,1,0,
+                0,1,0,0,0,0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,
+                1,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1,
+                0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,1,1,0,0,0,0,0,0,0,
+                0,1,1,1,1,0,1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,0,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,1,1,0,0,0,1,1,
+                0,0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,0,
+                0,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,
+                1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+                0,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,0,1,0,0,0,1,1,1,1,1,0,0,0,1,0,0,0,0,1,1,
+                1,1,1,1,1,1,0,1,1,1,1,1,0,0,1,1,0,0,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,0,1,0,1,
+                1,1,1,1,1,1,1,1,1,0,1,1,0,0,0,0,0,0,0,1,1,1,1,1,
+                1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,1,1,0,0,0,0,
+                0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,
+                1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,0,1,0,
+                1,0,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+                0,0,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+                1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+                1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,1,
+                1,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,1,0,0,0,0,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,0,1,1,0,0,1,1,1,1,1,1,0,1,1,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,0,1,1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,0,0,1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,1,
+                1,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,
+                0,0,0,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,
+                1,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,0,1,1,1,1,
+                1,1,1,1,1,1,0,1,0,0,0,0,0,0,0,1,0,1,0,1,1,0,0,0,
+                0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,0,1,0,0,0,0,0,1,0,1,1,1,
+                1,1,0,0,0,0,1,1,0,0,1,0,0,0,1,1,1,1,1,1,1,1,0,1,
+                0,0,1,1,1,0,1,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,
+                0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,1,1,0,1,1,
+                1,1,1,1,0,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,2,2,2,2,1,1,1,2,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,2,2,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+                2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,2,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,2,1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,2,2,1,1,
+                1,1,1,1,1,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,2,2,1,2,1,1,
+                1,1,2,1,1,2,1,1,1,1,1,1,1,2,1,1,1,1,2,2,1,1,1,1,
+                1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,2,1,2,1,1,1,1,2,2,2,1,2,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,2,2,1,1,1,
+                2,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+                2,2,1,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+                2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,2,2,2,2,2,2,2,2,
+                2,2,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+                1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+                1,0,0,2,2,2,2,2,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,
+                2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,0,0,0,1,0,0,0,0,
+                0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
+                1,1,0,1,1,1,0,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,0,1,
+                1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,
+                0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,0,
+                0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+                1,1,1,0,1,1,0,0,0,0,1,1,0,0,1,1,1,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,
+                1,0,0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,
+                1,1,1,1,0,1,1,1,0,1,0,0,0,1,1,0,0,1,1,1,1,1,0,0,
+                1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,
+                0,1,1,1,1,0,1,1,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,2,2,2,2,
+                2,2,1,1,1,1,1,1,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,1,2,2,2,2,1,1,1,1,2,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,1,1,1,1,1,
+                1,0,0,0,1,0,0,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,
+                0,0,0,1,1,1,1,0,1,1,1,1,0,0,0,0,1,1,1,1,1,1,1,1,
+                1,1,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+                0,1,1,0,0,1,1,1,1,1,1,1,1,1,1,0,1,1,1,0,0,0,0,1,
+                1,0,0,1,1,0,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,0,1,1,
+                1,1,1,1,1,1,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,
+                1,0,0,0,0,1,1,0,0,0,1,1,0,1,0,0,1,1,1,1,1,1,0,1,
+                1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,0,0,
+                0,0,0,0,0,1,1,1,1,1,1,0,0,0,0,0,0,1,0,1,1,1,1,0,
+                0,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,
+                1,1,1,1,0,0,1,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,1,0,
+                1,1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,0,0,0,0,0,0,1,0,
+                1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,0,0,0,0,0,1,1,1,1,
+                0,0,0,0,0,0,0,0,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,0,0,1,0,1,1,1,1,1,0,0,0,0,1,1,0,0,1,1,1,1,
+                1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,
+                0,1,1,0,0,0,0,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,
+                1,0,0,0,0,0,0,1,1,0,0,0,1,1,1,1,0,0,0,0,0,0,0,1,
+                0,0,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,
+                1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                1,1,0,0,0,0,0,0,0,1,0,0,1,0,0,1,1,1,1,1,1,1,1,1,
+                1,0,0,0,0,0,0,1,1,1,0,1,0,0,1,0,0,0,1,1,1,0,1,0,
+                1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,
+                0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,2,2,2,2,0,1,1,1,
+                1,1,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,2,2,2,2,1,2,2,2,
+                2,2,2,2,1,2,2,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+                1,1,1,1,1,1,1,0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,0,0,0,0,1,1,1,1,1,1,0,1,1,1,
+                1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,1,0,0,
+                0,0,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,2,2,2,2,2,2,2,
+                2,2,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,
+                2,2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,2,
+                2,1,1,1,2,1,1,1,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,2,2,2,2,1,1,1,1,1,1,2,2,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,1,1,
+                1,1,1,1,2,1,1,1,2,2,2,1,1,2,2,2,1,1,1,1,1,2,2,2,
+                1,1,1,1,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,2,2,2,
+                2,2,2,2,2,1,1,1,2,2,2,2,2,1,1,1,2,2,2,2,2,2,2,2,
+                2,2,2,1,1,1,1,1,
+            };
+            static constexpr uint8_t case_stage1[1088] = {
+                0,1,2,2,3,2,2,4,5,6,2,7,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,8,9,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,10,11,2,12,2,13,2,2,14,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,15,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,16,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,2,2,2,2,2,
+            };
+            static constexpr uint8_t case_stage2[2176] = {
+                0,0,0,0,0,0,0,0,1,2,2,3,4,5,5,6,0,0,0,0,0,0,7,0,
+                2,2,8,9,5,5,10,11,12,12,12,12,12,12,13,14,15,16,12,12,12,12,12,17,
+                18,19,20,21,22,23,24,25,26,27,15,28,12,12,29,12,12,12,12,12,30,12,31,32,
+                33,12,34,35,36,37,38,39,40,41,42,43,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,44,0,0,0,0,0,45,46,47,48,49,2,50,51,52,5,
+                53,54,55,12,12,12,56,57,58,58,2,2,2,2,5,5,5,5,59,59,12,12,12,12,
+                60,61,12,12,12,12,12,12,62,63,12,12,12,12,12,12,12,12,12,12,12,12,64,65,
+                65,65,66,0,67,68,68,68,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,70,70,70,
+                71,72,73,73,73,73,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,75,75,75,
+                75,75,75,75,75,75,76,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                78,79,80,80,80,80,80,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,82,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,84,85,12,12,12,12,
+                12,12,12,12,12,12,12,12,86,87,88,89,86,87,86,87,88,89,90,91,86,87,92,93,
+                94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,110,111,112,0,0,113,0,0,114,114,115,115,116,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,118,
+                118,118,119,119,119,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,65,65,65,65,65,65,68,68,68,68,68,68,121,122,123,124,
+                12,12,12,12,12,12,12,12,12,12,12,12,31,125,126,0,127,127,127,127,128,129,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,12,12,12,130,0,0,
+                12,12,12,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,12,61,12,
+                12,12,12,12,12,12,0,131,12,132,133,12,12,134,135,12,136,137,138,60,0,0,139,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,140,0,0,0,141,141,141,141,141,141,141,141,141,141,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,142,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,2,3,
+                4,5,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                144,144,144,144,144,145,145,145,145,145,0,0,0,0,0,0,0,0,0,0,0,0,144,144,
+                144,144,146,145,145,145,145,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,149,
+                148,149,150,151,152,151,152,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                154,154,154,154,154,154,155,0,156,156,156,156,156,156,157,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,5,5,5,5,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                2,2,2,2,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,158,158,158,159,160,160,160,
+                161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+                0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            };
+            static constexpr uint16_t case_stage3[1296] = {
+                0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+                1,1,1,0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+                2,2,2,0,0,0,0,0,0,0,0,0,0,3,0,0,1,1,1,1,1,1,1,0,
+                1,1,1,1,1,1,1,4,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,5,
+                6,7,6,7,6,7,6,7,8,9,6,7,6,7,6,7,0,6,7,6,7,6,7,6,
+                7,6,7,6,7,6,7,6,7,10,6,7,6,7,6,7,11,6,7,6,7,6,7,12,
+                13,14,6,7,6,7,15,6,7,16,16,6,7,0,17,18,19,6,7,16,20,21,22,23,
+                6,7,24,0,22,25,26,27,6,7,6,7,6,7,28,6,7,28,0,0,6,7,28,6,
+                7,29,29,6,7,6,7,30,6,7,0,0,6,7,0,31,0,0,0,0,32,33,34,32,
+                33,34,32,33,34,6,7,6,7,6,7,6,7,35,6,7,36,32,33,34,6,7,37,38,
+                39,0,6,7,6,7,6,7,6,7,6,7,0,0,0,0,0,0,40,6,7,41,42,43,
+                43,6,7,44,45,46,6,7,47,48,49,50,51,0,52,52,0,53,0,54,55,0,0,0,
+                52,56,0,57,0,58,59,0,60,61,59,62,63,0,0,61,0,64,65,0,0,66,0,0,
+                0,0,0,0,0,67,0,0,68,0,69,68,0,0,0,70,68,71,72,72,73,0,0,0,
+                0,0,74,0,0,0,0,0,0,0,0,0,0,75,76,0,0,0,0,0,0,77,0,0,
+                6,7,6,7,0,0,6,7,0,0,0,26,26,26,0,78,0,0,0,0,0,0,79,0,
+                80,80,80,0,81,0,82,82,83,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,
+                1,1,1,1,84,85,85,85,86,2,2,2,2,2,2,2,2,2,87,2,2,2,2,2,
+                2,2,2,2,88,89,89,90,91,92,0,0,0,93,94,95,96,97,98,99,100,101,0,6,
+                7,102,6,7,0,39,39,39,103,103,103,103,103,103,103,103,104,104,104,104,104,104,104,104,
+                6,7,0,0,0,0,0,0,0,0,6,7,6,7,6,7,105,6,7,6,7,6,7,6,
+                7,6,7,6,7,6,7,106,0,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+                107,107,107,107,107,107,107,0,0,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+                108,108,108,108,108,108,108,109,110,110,110,110,110,110,110,110,110,110,110,110,110,110,0,110,
+                0,0,0,0,0,110,0,0,111,111,111,111,111,111,111,111,111,111,111,0,0,111,111,111,
+                112,112,112,112,112,112,112,112,113,113,113,113,113,113,0,0,114,114,114,114,114,114,0,0,
+                115,116,117,118,118,119,120,121,122,0,0,0,0,0,0,0,123,123,123,123,123,123,123,123,
+                123,123,123,0,0,123,123,123,0,124,0,0,0,125,0,0,0,0,0,0,0,0,126,0,
+                6,7,6,7,6,7,127,128,129,130,131,132,0,0,133,0,134,134,134,134,134,134,134,134,
+                135,135,135,135,135,135,135,135,134,134,134,134,134,134,0,0,135,135,135,135,135,135,0,0,
+                136,134,137,134,138,134,139,134,0,135,0,135,0,135,0,135,140,140,141,141,141,141,142,142,
+                143,143,144,144,145,145,0,0,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,
+                162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,
+                186,187,188,189,190,191,192,193,134,134,194,195,196,0,197,198,135,135,199,199,200,0,201,0,
+                0,0,202,203,204,0,205,206,207,207,207,207,208,0,0,0,134,134,209,83,0,0,210,211,
+                135,135,212,212,0,0,0,0,134,134,213,86,214,98,215,216,135,135,217,217,102,0,0,0,
+                0,0,218,219,220,0,221,222,223,223,224,224,225,0,0,0,0,0,0,0,0,0,226,0,
+                0,0,227,228,0,0,0,0,0,0,229,0,0,0,0,0,0,0,0,0,0,0,230,0,
+                231,231,231,231,231,231,231,231,232,232,232,232,232,232,232,232,0,0,0,6,7,0,0,0,
+                0,0,0,0,0,0,233,233,233,233,233,233,233,233,233,233,234,234,234,234,234,234,234,234,
+                234,234,0,0,0,0,0,0,6,7,235,236,237,238,239,6,7,6,7,6,7,240,241,242,
+                243,0,6,7,0,6,7,0,0,0,0,0,0,0,244,244,0,0,0,6,7,6,7,0,
+                0,0,6,7,0,0,0,0,245,245,245,245,245,245,245,245,245,245,245,245,245,245,0,245,
+                0,0,0,0,0,245,0,0,6,7,6,7,6,7,0,0,0,6,7,6,7,246,6,7,
+                0,0,0,6,7,247,0,0,6,7,6,7,248,0,6,7,6,7,249,250,251,252,249,0,
+                253,254,255,256,6,7,6,7,6,7,6,7,257,258,259,6,7,6,7,0,0,0,0,0,
+                6,7,0,0,0,0,6,7,0,0,0,0,0,6,7,0,0,0,0,260,0,0,0,0,
+                261,261,261,261,261,261,261,261,262,263,264,265,266,267,267,0,0,0,0,268,269,270,271,272,
+                273,273,273,273,273,273,273,273,274,274,274,274,274,274,274,274,273,273,273,273,0,0,0,0,
+                274,274,274,274,0,0,0,0,275,275,275,275,275,275,275,275,275,275,275,0,275,275,275,275,
+                275,275,275,0,275,275,0,276,276,276,276,276,276,276,276,276,276,276,0,276,276,276,276,276,
+                276,276,0,276,276,0,0,0,81,81,81,81,81,81,81,81,81,81,81,0,0,0,0,0,
+                88,88,88,88,88,88,88,88,88,88,88,0,0,0,0,0,277,277,277,277,277,277,277,277,
+                277,277,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,278,0,0,0,0,
+            };
+            static constexpr int32_t case_records[279][3] = {
+                {0,0,0},{32,0,32},{0,-32,0},{0,743,775},{0,2097152,2097155},{0,121,0},{1,0,1},{0,-1,0},
+                {2097158,0,2097158},{0,-232,0},{0,2097161,2097164},{-121,0,-121},{0,-300,-268},{0,195,0},{210,0,210},{206,0,206},
+                {205,0,205},{79,0,79},{202,0,202},{203,0,203},{207,0,207},{0,97,0},{211,0,211},{209,0,209},
+                {0,163,0},{213,0,213},{0,130,0},{214,0,214},{218,0,218},{217,0,217},{219,0,219},{0,56,0},
+                {2,0,2},{1,-1,1},{0,-2,0},{0,-79,0},{0,2097167,2097170},{-97,0,-97},{-56,0,-56},{-130,0,-130},
+                {10795,0,10795},{-163,0,-163},{10792,0,10792},{0,10815,0},{-195,0,-195},{69,0,69},{71,0,71},{0,10783,0},
+                {0,10780,0},{0,10782,0},{0,-210,0},{0,-206,0},{0,-205,0},{0,-202,0},{0,-203,0},{0,42319,0},
+                {0,42315,0},{0,-207,0},{0,42280,0},{0,42308,0},{0,-209,0},{0,-211,0},{0,10743,0},{0,42305,0},
+                {0,10749,0},{0,-213,0},{0,-214,0},{0,10727,0},{0,-218,0},{0,42307,0},{0,42282,0},{0,-69,0},
+                {0,-217,0},{0,-71,0},{0,-219,0},{0,42261,0},{0,42258,0},{0,84,116},{116,0,116},{38,0,38},
+                {37,0,37},{64,0,64},{63,0,63},{0,2097173,2097177},{0,-38,0},{0,-37,0},{0,2097181,2097185},{0,-31,1},
+                {0,-64,0},{0,-63,0},{8,0,8},{0,-62,-30},{0,-57,-25},{0,-47,-15},{0,-54,-22},{0,-8,0},
+                {0,-86,-54},{0,-80,-48},{0,7,0},{0,-116,0},{-60,0,-60},{0,-96,-64},{-7,0,-7},{80,0,80},
+                {0,-80,0},{15,0,15},{0,-15,0},{48,0,48},{0,-48,0},{0,2097189,2097192},{7264,0,7264},{0,3008,0},
+                {38864,0,0},{8,0,0},{0,-8,-8},{0,-6254,-6222},{0,-6253,-6221},{0,-6244,-6212},{0,-6242,-6210},{0,-6243,-6211},
+                {0,-6236,-6204},{0,-6181,-6180},{0,35266,35267},{-3008,0,-3008},{0,35332,0},{0,3814,0},{0,35384,0},{0,2097195,2097198},
+                {0,2097201,2097204},{0,2097207,2097210},{0,2097213,2097216},{0,2097219,2097222},{0,-59,-58},{-7615,0,2097155},{0,8,0},{-8,0,-8},
+                {0,2097225,2097228},{0,2097231,2097235},{0,2097239,2097243},{0,2097247,2097251},{0,74,0},{0,86,0},{0,100,0},{0,128,0},
+                {0,112,0},{0,126,0},{0,2097255,2097258},{0,2097261,2097264},{0,2097267,2097270},{0,2097273,2097276},{0,2097279,2097282},{0,2097285,2097288},
+                {0,2097291,2097294},{0,2097297,2097300},{-8,2097255,2097258},{-8,2097261,2097264},{-8,2097267,2097270},{-8,2097273,2097276},{-8,2097279,2097282},{-8,2097285,2097288},
+                {-8,2097291,2097294},{-8,2097297,2097300},{0,2097303,2097306},{0,2097309,2097312},{0,2097315,2097318},{0,2097321,2097324},{0,2097327,2097330},{0,2097333,2097336},
+                {0,2097339,2097342},{0,2097345,2097348},{-8,2097303,2097306},{-8,2097309,2097312},{-8,2097315,2097318},{-8,2097321,2097324},{-8,2097327,2097330},{-8,2097333,2097336},
+                {-8,2097339,2097342},{-8,2097345,2097348},{0,2097351,2097354},{0,2097357,2097360},{0,2097363,2097366},{0,2097369,2097372},{0,2097375,2097378},{0,2097381,2097384},
+                {0,2097387,2097390},{0,2097393,2097396},{-8,2097351,2097354},{-8,2097357,2097360},{-8,2097363,2097366},{-8,2097369,2097372},{-8,2097375,2097378},{-8,2097381,2097384},
+                {-8,2097387,2097390},{-8,2097393,2097396},{0,2097399,2097402},{0,2097405,2097408},{0,2097411,2097414},{0,2097417,2097420},{0,2097423,2097427},{-74,0,-74},
+                {-9,2097405,2097408},{0,-7205,-7173},{0,2097431,2097434},{0,2097437,2097440},{0,2097443,2097446},{0,2097449,2097452},{0,2097455,2097459},{-86,0,-86},
+                {-9,2097437,2097440},{0,2097463,2097467},{0,2097471,2097474},{0,2097477,2097481},{-100,0,-100},{0,2097485,2097489},{0,2097493,2097496},{0,2097499,2097502},
+                {0,2097505,2097509},{-112,0,-112},{0,2097513,2097516},{0,2097519,2097522},{0,2097525,2097528},{0,2097531,2097534},{0,2097537,2097541},{-128,0,-128},
+                {-126,0,-126},{-9,2097519,2097522},{-7517,0,-7517},{-8383,0,-8383},{-8262,0,-8262},{28,0,28},{0,-28,0},{16,0,16},
+                {0,-16,0},{26,0,26},{0,-26,0},{-10743,0,-10743},{-3814,0,-3814},{-10727,0,-10727},{0,-10795,0},{0,-10792,0},
+                {-10780,0,-10780},{-10749,0,-10749},{-10783,0,-10783},{-10782,0,-10782},{-10815,0,-10815},{0,-7264,0},{-35332,0,-35332},{-42280,0,-42280},
+                {0,48,0},{-42308,0,-42308},{-42319,0,-42319},{-42315,0,-42315},{-42305,0,-42305},{-42258,0,-42258},{-42282,0,-42282},{-42261,0,-42261},
+                {928,0,928},{-48,0,-48},{-42307,0,-42307},{-35384,0,-35384},{0,-928,0},{0,-38864,-38864},{0,2097545,2097548},{0,2097551,2097554},
+                {0,2097557,2097560},{0,2097563,2097567},{0,2097571,2097575},{0,2097579,2097582},{0,2097585,2097588},{0,2097591,2097594},{0,2097597,2097600},{0,2097603,2097606},
+                {0,2097609,2097612},{40,0,40},{0,-40,0},{39,0,39},{0,-39,0},{34,0,34},{0,-34,0},
+            };
+            static constexpr codepoint_type case_special[463] = {
+                2,83,83,2,115,115,2,105,775,2,700,78,2,700,110,2,74,780,2,106,780,3,921,776,
+                769,3,953,776,769,3,933,776,769,3,965,776,769,2,1333,1362,2,1381,1410,2,72,817,2,104,
+                817,2,84,776,2,116,776,2,87,778,2,119,778,2,89,778,2,121,778,2,65,702,2,97,
+                702,2,933,787,2,965,787,3,933,787,768,3,965,787,768,3,933,787,769,3,965,787,769,3,
+                933,787,834,3,965,787,834,2,7944,921,2,7936,953,2,7945,921,2,7937,953,2,7946,921,2,7938,
+                953,2,7947,921,2,7939,953,2,7948,921,2,7940,953,2,7949,921,2,7941,953,2,7950,921,2,7942,
+                953,2,7951,921,2,7943,953,2,7976,921,2,7968,953,2,7977,921,2,7969,953,2,7978,921,2,7970,
+                953,2,7979,921,2,7971,953,2,7980,921,2,7972,953,2,7981,921,2,7973,953,2,7982,921,2,7974,
+                953,2,7983,921,2,7975,953,2,8040,921,2,8032,953,2,8041,921,2,8033,953,2,8042,921,2,8034,
+                953,2,8043,921,2,8035,953,2,8044,921,2,8036,953,2,8045,921,2,8037,953,2,8046,921,2,8038,
+                953,2,8047,921,2,8039,953,2,8122,921,2,8048,953,2,913,921,2,945,953,2,902,921,2,940,
+                953,2,913,834,2,945,834,3,913,834,921,3,945,834,953,2,8138,921,2,8052,953,2,919,921,
+                2,951,953,2,905,921,2,942,953,2,919,834,2,951,834,3,919,834,921,3,951,834,953,3,
+                921,776,768,3,953,776,768,2,921,834,2,953,834,3,921,776,834,3,953,776,834,3,933,776,
+                768,3,965,776,768,2,929,787,2,961,787,2,933,834,2,965,834,3,933,776,834,3,965,776,
+                834,2,8186,921,2,8060,953,2,937,921,2,969,953,2,911,921,2,974,953,2,937,834,2,969,
+                834,3,937,834,921,3,969,834,953,2,70,70,2,102,102,2,70,73,2,102,105,2,70,76,
+                2,102,108,3,70,70,73,3,102,102,105,3,70,70,76,3,102,102,108,2,83,84,2,115,
+                116,2,1348,1350,2,1396,1398,2,1348,1333,2,1396,1381,2,1348,1339,2,1396,1387,2,1358,1350,2,1406,
+                1398,2,1348,1341,2,1396,1389,
+            };
+        };
+        template <typename T> constexpr uint8_t ucd_tables<T>::general_category_stage1[2176];
+        template <typename T> constexpr uint16_t ucd_tables<T>::general_category_stage2[3136];
+        template <typename T> constexpr uint8_t ucd_tables<T>::general_category_stage3[10720];
+        template <typename T> constexpr uint8_t ucd_tables<T>::script_stage1[2176];
+        template <typename T> constexpr uint16_t ucd_tables<T>::script_stage2[3232];
+        template <typename T> constexpr uint8_t ucd_tables<T>::script_stage3[10624];
+        template <typename T> constexpr uint8_t ucd_tables<T>::east_asian_width_stage1[1088];
+        template <typename T> constexpr uint8_t ucd_tables<T>::east_asian_width_stage2[1792];
+        template <typename T> constexpr uint8_t ucd_tables<T>::east_asian_width_stage3[2272];
+        template <typename T> constexpr uint8_t ucd_tables<T>::binary_properties_stage1[4352];
+        template <typename T> constexpr uint8_t ucd_tables<T>::binary_properties_stage2[9280];
+        template <typename T> constexpr uint8_t ucd_tables<T>::binary_properties_stage3[744];
+        template <typename T> constexpr uint8_t ucd_tables<T>::grapheme_break_stage1[2176];
+        template <typename T> constexpr uint8_t ucd_tables<T>::grapheme_break_stage2[4544];
+        template <typename T> constexpr uint8_t ucd_tables<T>::grapheme_break_stage3[1904];
+        template <typename T> constexpr uint8_t ucd_tables<T>::display_width_stage1[1088];
+        template <typename T> constexpr uint8_t ucd_tables<T>::display_width_stage2[2944];
+        template <typename T> constexpr uint8_t ucd_tables<T>::display_width_stage3[3536];
+        template <typename T> constexpr uint8_t ucd_tables<T>::case_stage1[1088];
+        template <typename T> constexpr uint8_t ucd_tables<T>::case_stage2[2176];
+        template <typename T> constexpr uint16_t ucd_tables<T>::case_stage3[1296];
+        template <typename T> constexpr int32_t ucd_tables<T>::case_records[279][3];
+        template <typename T> constexpr codepoint_type ucd_tables<T>::case_special[463];
+    }
+
+    // General_Category
+    constexpr general_category get_general_category(codepoint_type c) {
+        return c > 0x10ffff ? gc_cn : static_cast<general_category>(internal::ucd_tables<void>::general_category_stage3[(internal::ucd_tables<void>::general_category_stage2[(internal::ucd_tables<void>::general_category_stage1[c >> 9] << 5) | ((c >> 4) & 31)] << 4) | (c & 15)]);
+    }
+
+    // Script
+    constexpr script get_script(codepoint_type c) {
+        return c > 0x10ffff ? sc_unknown : static_cast<script>(internal::ucd_tables<void>::script_stage3[(internal::ucd_tables<void>::script_stage2[(internal::ucd_tables<void>::script_stage1[c >> 9] << 5) | ((c >> 4) & 31)] << 4) | (c & 15)]);
+    }
+
+    // East_Asian_Width
+    constexpr east_asian_width get_east_asian_width(codepoint_type c) {
+        return c > 0x10ffff ? eaw_neutral : static_cast<east_asian_width>(internal::ucd_tables<void>::east_asian_width_stage3[(internal::ucd_tables<void>::east_asian_width_stage2[(internal::ucd_tables<void>::east_asian_width_stage1[c >> 10] << 6) | ((c >> 4) & 63)] << 4) | (c & 15)]);
+    }
+
+    // Grapheme_Cluster_Break, with Extended_Pictographic folded in
+    constexpr grapheme_break get_grapheme_break(codepoint_type c) {
+        return c > 0x10ffff ? gcb_other : static_cast<grapheme_break>(internal::ucd_tables<void>::grapheme_break_stage3[(internal::ucd_tables<void>::grapheme_break_stage2[(internal::ucd_tables<void>::grapheme_break_stage1[c >> 9] << 6) | ((c >> 3) & 63)] << 3) | (c & 7)]);
+    }
+
+    // Number of terminal columns taken up by c: 2 for wide and fullwidth
+    // characters, 0 for combining marks, format and control characters,
+    // and 1 for everything else
+    constexpr unsigned get_display_width(codepoint_type c) {
+        return c > 0x10ffff ? 1 : internal::ucd_tables<void>::display_width_stage3[(internal::ucd_tables<void>::display_width_stage2[(internal::ucd_tables<void>::display_width_stage1[c >> 10] << 6) | ((c >> 4) & 63)] << 4) | (c & 15)];
+    }
+
+    // all the binary properties of c, as a mask of binary_property values
+    constexpr unsigned get_binary_properties(codepoint_type c) {
+        return c > 0x10ffff ? 0 : internal::ucd_tables<void>::binary_properties_stage3[(internal::ucd_tables<void>::binary_properties_stage2[(internal::ucd_tables<void>::binary_properties_stage1[c >> 8] << 6) | ((c >> 2) & 63)] << 2) | (c & 3)];
+    }
+    constexpr bool has_property(codepoint_type c, binary_property p) {
+        return (get_binary_properties(c) & p) != 0;
+    }
+
+    // the most code points a single code point is mapped to by
+    // get_case_mapping
+    constexpr unsigned max_case_mapping_length = 3;
+
+    // The full lowercase mapping, uppercase mapping or case folding of c,
+    // leaving out the mappings which depend on context or language.
+    // Writes the mapped code points, at most max_case_mapping_length, to
+    // dest and returns how many there are
+    inline unsigned get_case_mapping(codepoint_type c, case_mapping m, codepoint_type* dest) {
+        const int32_t v = c > 0x10ffff ? 0 : internal::ucd_tables<void>::case_records[internal::ucd_tables<void>::case_stage3[(internal::ucd_tables<void>::case_stage2[(internal::ucd_tables<void>::case_stage1[c >> 10] << 7) | ((c >> 3) & 127)] << 3) | (c & 7)]][m];
+        if (v < 0x200000) {
+            *dest = c + v;
+            return 1;
+        }
+        const codepoint_type* s = internal::ucd_tables<void>::case_special + (v - 0x200000);
+        for (unsigned i = 0; i < s[0]; ++i) { dest[i] = s[i + 1]; }
+        return s[0];
+    }
+}
+
+#endif
@@ -0,0 +1,363 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Unicode text algorithms on top of utf.hpp, using the property tables in
+// utf_ucd.hpp. Requires C++11.
+
+#ifndef NP_UTF_UNICODE_HPP
+#define NP_UTF_UNICODE_HPP
+
+#include <iterator>
+
+#include "utf.hpp"
+#include "utf_ucd.hpp"
+
+namespace utf {
+    namespace internal {
+        // True if there is no extended grapheme cluster boundary between
+        // code points with the properties prev and cur (UAX #29, GB3 to
+        // GB13). emoji_zwj is true if prev ends an Extended_Pictographic
+        // Extend* ZWJ sequence, odd_ri if prev ends an odd-length run of
+        // regional indicators.
+        inline bool grapheme_continues(grapheme_break prev, grapheme_break cur, bool emoji_zwj, bool odd_ri) {
+            if (prev == gcb_cr) { return cur == gcb_lf; }
+            if (prev == gcb_lf || prev == gcb_control) { return false; }
+            switch (cur) {
+            case gcb_cr: case gcb_lf: case gcb_control:
+                return false;
+            case gcb_extend: case gcb_zwj: case gcb_spacing_mark:
+                return true;
+            default:
+                break;
+            }
+            switch (prev) {
+            case gcb_prepend:
+                return true;
+            case gcb_l:
+                return cur == gcb_l || cur == gcb_v || cur == gcb_lv || cur == gcb_lvt;
+            case gcb_lv: case gcb_v:
+                return cur == gcb_v || cur == gcb_t;
+            case gcb_lvt: case gcb_t:
+                return cur == gcb_t;
+            case gcb_zwj:
+                return cur == gcb_extended_pictographic && emoji_zwj;
+            case gcb_regional_indicator:
+                return cur == gcb_regional_indicator && odd_ri;
+            default:
+                return false;
+            }
+        }
+    }
+
+    // The end of the extended grapheme cluster starting at pos, stopping at
+    // last. Clusters of plain ASCII are found without any table lookups.
+    template <typename It>
+    codepoint_iterator<It> next_grapheme(codepoint_iterator<It> pos, codepoint_iterator<It> last) {
+        if (pos == last) { return pos; }
+        codepoint_type c = *pos;
+        ++pos;
+        if (pos == last) { return pos; }
+        codepoint_type d = *pos;
+        // an ASCII character other than CR, followed by another, is a whole cluster
+        if (c < 0x80 && d < 0x80 && c != '\r') { return pos; }
+
+        grapheme_break prev = get_grapheme_break(c);
+        // the state for GB11 and GB12/13
+        bool emoji = prev == gcb_extended_pictographic;
+        bool emoji_zwj = false;
+        bool odd_ri = prev == gcb_regional_indicator;
+        for (;;) {
+            grapheme_break cur = get_grapheme_break(d);
+            if (!internal::grapheme_continues(prev, cur, emoji_zwj, odd_ri)) { break; }
+            emoji_zwj = emoji && cur == gcb_zwj;
+            emoji = cur == gcb_extended_pictographic || (emoji && cur == gcb_extend);
+            odd_ri = cur == gcb_regional_indicator && !odd_ri;
+            prev = cur;
+            ++pos;
+            if (pos == last) { break; }
+            d = *pos;
+        }
+        return pos;
+    }
+
+    // Iterates over the extended grapheme clusters (user-perceived
+    // characters) of a string, as defined by UAX #29. Each cluster is
+    // returned as a stringview of its code units.
+    template <typename It>
+    class grapheme_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef stringview<It> value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        grapheme_iterator() : pos(), next(), last() {}
+        // the cluster starting at pos, which must be at a cluster boundary
+        grapheme_iterator(It pos, It last)
+        : pos(pos), next(next_grapheme(codepoint_iterator<It>(pos), codepoint_iterator<It>(last)).base()), last(last) {}
+        template <typename E>
+        explicit grapheme_iterator(const stringview<It, E>& sv)
+        : pos(sv.begin().base()), next(next_grapheme(sv.begin(), sv.end()).base()), last(sv.end().base()) {}
+
+        reference operator*() const { return value_type(pos, next); }
+        grapheme_iterator& operator++() {
+            pos = next;
+            next = next_grapheme(codepoint_iterator<It>(pos), codepoint_iterator<It>(last)).base();
+            return *this;
+        }
+        grapheme_iterator operator++(int) {
+            grapheme_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator == (const grapheme_iterator& lhs, const grapheme_iterator& rhs) { return lhs.pos == rhs.pos; }
+        friend bool operator != (const grapheme_iterator& lhs, const grapheme_iterator& rhs) { return !(lhs == rhs); }
+
+        // the underlying code unit iterator
+        It base() const { return pos; }
+
+    private:
+        It pos;
+        It next;
+        It last;
+    };
+
+    // the first and past-the-end grapheme clusters of sv
+    template <typename It, typename E>
+    grapheme_iterator<It> grapheme_begin(const stringview<It, E>& sv) {
+        return grapheme_iterator<It>(sv);
+    }
+    template <typename It, typename E>
+    grapheme_iterator<It> grapheme_end(const stringview<It, E>& sv) {
+        return grapheme_iterator<It>(sv.end().base(), sv.end().base());
+    }
+
+    namespace internal {
+        // columns taken up by c. ASCII control characters take none
+        inline unsigned codepoint_width(codepoint_type c) {
+            return c < 0x80 ? (c >= 0x20 && c != 0x7f) : get_display_width(c);
+        }
+
+        // Advance pos over code points as long as the total width stays
+        // within max, adding their widths to width
+        template <typename E, typename It>
+        struct width_scan {
+            typedef utf_traits<E> traits_t;
+
+            static It scan(It pos, It last, size_t& width, size_t max) {
+                while (pos != last) {
+                    unsigned w = codepoint_width(traits_t::decode(pos));
+                    if (max - width < w) { break; }
+                    width += w;
+                    pos += traits_t::read_length(static_cast<typename traits_t::codeunit_type>(*pos));
+                }
+                return pos;
+            }
+        };
+
+        // UTF-8 in memory: runs of ASCII are measured 8 bytes at a time, if
+        // the code units are bytes
+        template <typename T>
+        struct width_scan<utf8, T*> {
+            typedef utf_traits<utf8> traits_t;
+
+            static T* scan(T* pos, T* last, size_t& width, size_t max) {
+                while (pos != last) {
+                    while (sizeof(T) == 1 && max - width >= 8 && last - pos >= 8 && ascii8(pos)) {
+                        unsigned w = 0;
+                        for (size_t i = 0; i < 8; ++i) {
+                            w += pos[i] >= 0x20 && pos[i] != 0x7f;
+                        }
+                        width += w;
+                        pos += 8;
+                    }
+                    if (pos == last) { break; }
+                    unsigned w = codepoint_width(traits_t::decode(pos));
+                    if (max - width < w) { break; }
+                    width += w;
+                    pos += traits_t::read_length(*pos);
+                }
+                return pos;
+            }
+        };
+    }
+
+    // The number of columns sv takes up in a terminal, as the sum of the
+    // code points' widths: 2 for East_Asian_Width Wide and Fullwidth, 0 for
+    // combining marks, format, control and other default ignorable code
+    // points, and 1 for everything else, including ambiguous width
+    // characters.
+    template <typename Iter, typename E>
+    size_t display_width(const stringview<Iter, E>& sv) {
+        size_t width = 0;
+        internal::width_scan<E, Iter>::scan(sv.begin().base(), sv.end().base(), width, static_cast<size_t>(-1));
+        return width;
+    }
+
+    // The end of the longest prefix of sv which fits in cols columns, as
+    // measured by display_width. Zero width code points following the last
+    // character which fits are included.
+    template <typename Iter, typename E>
+    codepoint_iterator<Iter> truncate_to_width(const stringview<Iter, E>& sv, size_t cols) {
+        size_t width = 0;
+        return codepoint_iterator<Iter>(internal::width_scan<E, Iter>::scan(sv.begin().base(), sv.end().base(), width, cols));
+    }
+
+    // Like truncate_bytes, but the prefix also ends on a grapheme cluster
+    // boundary, so no user-perceived character is cut in half. Clusters
+    // have to be found from the start of sv, so this takes time linear in
+    // max_bytes.
+    template <typename Iter, typename E>
+    stringview<Iter, E> truncate_bytes_at_grapheme(const stringview<Iter, E>& sv, size_t max_bytes) {
+        const Iter first = sv.begin().base();
+        const ptrdiff_t limit = truncate_bytes(sv, max_bytes).codeunits();
+        if (limit == static_cast<ptrdiff_t>(sv.codeunits())) { return sv; }
+        codepoint_iterator<Iter> pos = sv.begin();
+        for (;;) {
+            codepoint_iterator<Iter> next = next_grapheme(pos, sv.end());
+            if (next.base() - first > limit) { break; }
+            pos = next;
+        }
+        return stringview<Iter, E>(first, pos.base());
+    }
+
+    namespace internal {
+        // ASCII [0-9A-Z_a-z], which are exactly the ASCII XID_Continue
+        // characters, as a 128-bit bitmap
+        inline bool ascii_identifier_char(uint32_t u) {
+            static const uint64_t bits[2] = { 0x03ff000000000000ULL, 0x07fffffe87fffffeULL };
+            return (bits[u >> 6] >> (u & 63)) & 1;
+        }
+    }
+
+    // The end of the identifier at the start of sv, or sv.begin() if sv
+    // does not start with one. Identifiers follow the default syntax of
+    // UAX #31, with '_' also allowed as the first character: an XID_Start
+    // code point followed by any number of XID_Continue code points. ASCII
+    // code units are classified with a bitmap, without decoding; only
+    // non-ASCII code points are looked up in the property tables.
+    template <typename Iter, typename E>
+    codepoint_iterator<Iter> scan_identifier(const stringview<Iter, E>& sv) {
+        typedef internal::utf_traits<E> traits_t;
+        typedef typename traits_t::codeunit_type unit_type;
+        Iter pos = sv.begin().base();
+        const Iter last = sv.end().base();
+        if (pos == last) { return codepoint_iterator<Iter>(pos); }
+        codepoint_type c = traits_t::decode(pos);
+        if (c != '_' && !has_property(c, prop_xid_start)) { return codepoint_iterator<Iter>(pos); }
+        pos += traits_t::read_length(static_cast<unit_type>(*pos));
+        while (pos != last) {
+            uint32_t u = static_cast<uint32_t>(static_cast<unit_type>(*pos));
+            if (u < 0x80) {
+                if (!internal::ascii_identifier_char(u)) { break; }
+                ++pos;
+                continue;
+            }
+            if (!has_property(traits_t::decode(pos), prop_xid_continue)) { break; }
+            pos += traits_t::read_length(static_cast<unit_type>(*pos));
+        }
+        return codepoint_iterator<Iter>(pos);
+    }
+
+    namespace internal {
+        // flip bit 0x20 of the bytes of w in [lo, hi]. All bytes must be
+        // ASCII, so adding to them never carries into the next byte
+        inline uint64_t ascii8_flip_case(uint64_t w, unsigned lo, unsigned hi) {
+            const uint64_t ones = 0x0101010101010101ULL;
+            uint64_t ge_lo = w + ones * (0x80 - lo);
+            uint64_t gt_hi = w + ones * (0x7f - hi);
+            return w ^ (((ge_lo & ~gt_hi) & (ones * 0x80)) >> 2);
+        }
+
+        // the ASCII letters changed by each case mapping
+        inline unsigned case_range_first(case_mapping m) { return m == cm_upper ? 'a' : 'A'; }
+        inline unsigned case_range_last(case_mapping m) { return m == cm_upper ? 'z' : 'Z'; }
+
+        // encodes the case mapping of each code point as EDest
+        template <typename EDest, typename OutIt>
+        struct case_encoder {
+            OutIt dest;
+            case_mapping m;
+
+            void operator()(codepoint_type c) {
+                if (c < 0x80) {
+                    if (c >= case_range_first(m) && c <= case_range_last(m)) { c ^= 0x20; }
+                    dest = utf_traits<EDest>::encode(c, dest);
+                    return;
+                }
+                codepoint_type buf[max_case_mapping_length];
+                unsigned n = get_case_mapping(c, m, buf);
+                for (unsigned i = 0; i < n; ++i) {
+                    dest = utf_traits<EDest>::encode(buf[i], dest);
+                }
+            }
+        };
+
+        template <typename E, typename Iter>
+        struct case_transform {
+            template <typename EDest, typename OutIt>
+            static OutIt run(Iter first, Iter last, case_mapping m, OutIt dest) {
+                case_encoder<EDest, OutIt> enc = { dest, m };
+                for_each_block(codepoint_iterator<Iter>(first), codepoint_iterator<Iter>(last), enc);
+                return enc.dest;
+            }
+        };
+
+        // UTF-8 in memory: runs of ASCII are mapped 8 bytes at a time
+        template <typename T>
+        struct case_transform<utf8, T*> {
+            template <typename EDest, typename OutIt>
+            static OutIt run(T* first, T* last, case_mapping m, OutIt dest) {
+                typedef utf_traits<utf8> traits_t;
+                case_encoder<EDest, OutIt> enc = { dest, m };
+                while (first != last) {
+                    while (last - first >= 8 && ascii8(first)) {
+                        uint64_t w;
+                        std::memcpy(&w, first, sizeof(w));
+                        w = ascii8_flip_case(w, case_range_first(m), case_range_last(m));
+                        unsigned char bytes[8];
+                        std::memcpy(bytes, &w, sizeof(w));
+                        for (size_t i = 0; i < 8; ++i) {
+                            enc.dest = utf_traits<EDest>::encode(bytes[i], enc.dest);
+                        }
+                        first += 8;
+                    }
+                    if (first == last) { break; }
+                    enc(traits_t::decode(first));
+                    first += traits_t::read_length(*first);
+                }
+                return enc.dest;
+            }
+        };
+    }
+
+    // Encode the full lowercase mapping of sv as EDest to dest, like
+    // sv.to<EDest>(dest). The result may be longer than sv: "\u0130" maps
+    // to "i\u0307". Mappings which depend on context or language, such as
+    // final sigma and the Turkish dotless i, are not applied.
+    template <typename EDest, typename Iter, typename E, typename OutIt>
+    OutIt to_lower(const stringview<Iter, E>& sv, OutIt dest) {
+        return internal::case_transform<E, Iter>::template run<EDest>(sv.begin().base(), sv.end().base(), cm_lower, dest);
+    }
+
+    // Encode the full uppercase mapping of sv as EDest to dest, so "\u00df"
+    // becomes "SS"
+    template <typename EDest, typename Iter, typename E, typename OutIt>
+    OutIt to_upper(const stringview<Iter, E>& sv, OutIt dest) {
+        return internal::case_transform<E, Iter>::template run<EDest>(sv.begin().base(), sv.end().base(), cm_upper, dest);
+    }
+
+    // Encode the full case folding of sv as EDest to dest. Strings which
+    // only differ in case fold to the same string, so this is the form to
+    // compare or hash for caseless matching.
+    template <typename EDest, typename Iter, typename E, typename OutIt>
+    OutIt case_fold(const stringview<Iter, E>& sv, OutIt dest) {
+        return internal::case_transform<E, Iter>::template run<EDest>(sv.begin().base(), sv.end().base(), cm_fold, dest);
+    }
+}
+
+#endif
@@ -0,0 +1,575 @@
+//          Copyright Jesper Dam 2013.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// utfconv: convert files between UTF-8, UTF-16 and UTF-32 (native endianness)
+//
+// usage: utfconv [options] input [output]
+//
+// The input file is memory mapped and wrapped in a stringview directly, so no
+// copy of the source data is ever made. When the output is a regular file
+// named on the command line, it is sized up front (the exact length is known
+// from stringview::bytes<E>()) and mapped as well, so the converted data is
+// written straight into the page cache. stdout is always streamed.
+//
+// Input that can't be mapped (pipes, stdin) goes through a pipeline instead:
+// a reader thread cuts the stream into blocks on code point boundaries,
+// worker threads convert blocks independently, and a writer thread emits the
+// results in their original order. Blocks travel between the threads through
+// bounded single-producer/single-consumer queues and are recycled, so the
+// pipeline allocates nothing once it is running.
+//
+// POSIX only. Define UTFCONV_NO_MAIN to include the tool in another program
+// and run it through utfconv_main.
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utf.hpp"
+
+namespace {
+    enum encoding_id { enc_utf8, enc_utf16, enc_utf32, enc_invalid };
+
+    struct options {
+        encoding_id from;
+        encoding_id to;
+        bool validate_only;
+        bool count;
+        bool stats;
+        unsigned jobs;
+        const char* input;
+        const char* output;
+
+        options() : from(enc_utf8), to(enc_utf16), validate_only(false), count(false), stats(false), jobs(0), input(0), output(0) {}
+    };
+
+    encoding_id parse_encoding(const char* name) {
+        if (std::strcmp(name, "utf8") == 0 || std::strcmp(name, "UTF-8") == 0) { return enc_utf8; }
+        if (std::strcmp(name, "utf16") == 0 || std::strcmp(name, "UTF-16") == 0) { return enc_utf16; }
+        if (std::strcmp(name, "utf32") == 0 || std::strcmp(name, "UTF-32") == 0) { return enc_utf32; }
+        return enc_invalid;
+    }
+
+    size_t unit_size(encoding_id e) {
+        switch (e) {
+            case enc_utf8: return 1;
+            case enc_utf16: return 2;
+            case enc_utf32: return 4;
+            default: return 0;
+        }
+    }
+
+    void usage() {
+        std::fprintf(stderr,
+            "usage: utfconv [options] input [output]\n"
+            "\n"
+            "  -f, --from ENC     encoding of input (utf8, utf16, utf32). Default utf8\n"
+            "  -t, --to ENC       encoding of output (utf8, utf16, utf32). Default utf16\n"
+            "      --validate-only  check that the input is well-formed, and exit\n"
+            "      --count        print the number of code points in the input, and exit\n"
+            "      --stats        print throughput to stderr\n"
+            "  -j, --jobs N       number of conversion threads for unmappable input\n"
+            "\n"
+            "If input is '-', it is read from stdin. If no output is given, or it is '-',\n"
+            "the result is written to stdout.\n"
+            "Exit status is 0 on success, 1 if the input is malformed and 2 on other errors.\n");
+    }
+
+    bool parse_args(int argc, char** argv, options& opts) {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strcmp(arg, "-f") == 0 || std::strcmp(arg, "--from") == 0
+                || std::strcmp(arg, "-t") == 0 || std::strcmp(arg, "--to") == 0) {
+                if (i + 1 == argc) { return false; }
+                encoding_id e = parse_encoding(argv[++i]);
+                if (e == enc_invalid) { return false; }
+                (arg[1] == 'f' || arg[2] == 'f' ? opts.from : opts.to) = e;
+            }
+            else if (std::strcmp(arg, "--validate-only") == 0) { opts.validate_only = true; }
+            else if (std::strcmp(arg, "--count") == 0) { opts.count = true; }
+            else if (std::strcmp(arg, "--stats") == 0) { opts.stats = true; }
+            else if (std::strcmp(arg, "-j") == 0 || std::strcmp(arg, "--jobs") == 0) {
+                if (i + 1 == argc) { return false; }
+                int n = std::atoi(argv[++i]);
+                if (n <= 0) { return false; }
+                opts.jobs = static_cast<unsigned>(n);
+            }
+            else if (arg[0] == '-' && arg[1] != '\0') { return false; }
+            else if (!opts.input) { opts.input = arg; }
+            else if (!opts.output) { opts.output = arg; }
+            else { return false; }
+        }
+        return opts.input != 0;
+    }
+
+    // read-only mapping of an entire regular file
+    struct mapped_input {
+        const void* data;
+        size_t size;
+
+        mapped_input() : data(0), size(0) {}
+        ~mapped_input() {
+            if (size != 0) { munmap(const_cast<void*>(data), size); }
+        }
+
+        bool map(int fd, size_t len) {
+            if (len == 0) { return true; }
+            void* p = mmap(0, len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) { return false; }
+            madvise(p, len, MADV_SEQUENTIAL);
+            data = p;
+            size = len;
+            return true;
+        }
+    };
+
+    bool write_all(int fd, const char* p, size_t n) {
+        while (n != 0) {
+            ssize_t w = ::write(fd, p, n);
+            if (w < 0 && errno == EINTR) { continue; }
+            if (w < 0) { return false; }
+            p += w;
+            n -= static_cast<size_t>(w);
+        }
+        return true;
+    }
+
+    // maximum number of code units needed to encode a single code point
+    size_t max_units(utf::utf8*) { return 4; }
+    size_t max_units(utf::utf16*) { return 2; }
+    size_t max_units(utf::utf32*) { return 1; }
+
+    // Encode sv into a mapping of a pre-sized regular file, or through a
+    // bounded buffer when the destination can't be mapped (pipes, ttys).
+    // stdout is always streamed: it may be a file opened for appending by the
+    // shell, and resizing it would destroy what is already there.
+    template <typename EDest, typename Iter, typename E>
+    bool write_output(const utf::stringview<Iter, E>& sv, const char* path) {
+        typedef typename utf::internal::utf_traits<EDest>::codeunit_type out_type;
+        const size_t out_bytes = sv.template bytes<EDest>();
+
+        int fd = 1;
+        if (path && std::strcmp(path, "-") != 0) {
+            fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+            if (fd < 0) { return false; }
+        }
+
+        struct stat st;
+        bool ok = fstat(fd, &st) == 0;
+        if (ok && fd != 1 && S_ISREG(st.st_mode) && out_bytes != 0 && ftruncate(fd, static_cast<off_t>(out_bytes)) == 0) {
+            void* p = mmap(0, out_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED) {
+                sv.template to<EDest>(static_cast<out_type*>(p));
+                ok = munmap(p, out_bytes) == 0;
+                return close(fd) == 0 && ok;
+            }
+        }
+
+        // fall back to converting a chunk at a time. Chunks are cut on code
+        // point boundaries, so each one is a stringview that to() converts
+        // with its block kernels
+        typedef typename utf::internal::utf_traits<E>::codeunit_type in_type;
+        const size_t chunk_units = 16 * 1024;
+        const size_t chunk_bytes = chunk_units / max_units(static_cast<EDest*>(0)) * sizeof(in_type);
+        out_type buf[chunk_units];
+        const Iter last = sv.end().base();
+        for (Iter pos = sv.begin().base(); ok && pos != last;) {
+            const utf::stringview<Iter, E> chunk = utf::truncate_bytes(utf::stringview<Iter, E>(pos, last), chunk_bytes);
+            const out_type* out = chunk.template to<EDest>(buf);
+            ok = write_all(fd, reinterpret_cast<const char*>(buf), (out - buf) * sizeof(out_type));
+            pos = chunk.end().base();
+        }
+        if (fd != 1) { ok = close(fd) == 0 && ok; }
+        return ok;
+    }
+
+    int open_output(const char* path) {
+        if (!path || std::strcmp(path, "-") == 0) { return 1; }
+        return ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+
+    // bounded lock-free queue with exactly one producer and one consumer thread
+    template <typename T>
+    class spsc_queue {
+        std::vector<T> slots;
+        size_t mask;
+        // keep the two indices on separate cache lines
+        char pad0[64];
+        std::atomic<size_t> head; // next slot to pop
+        char pad1[64];
+        std::atomic<size_t> tail; // next slot to push
+
+    public:
+        // capacity is rounded up to a power of two
+        explicit spsc_queue(size_t capacity) : mask(0), head(0), tail(0) {
+            size_t n = 1;
+            while (n < capacity) { n *= 2; }
+            slots.resize(n);
+            mask = n - 1;
+        }
+
+        bool try_push(const T& v) {
+            size_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) == slots.size()) { return false; }
+            slots[t & mask] = v;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+        bool try_pop(T& v) {
+            size_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire)) { return false; }
+            v = slots[h & mask];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+    };
+
+    // spin briefly, then back off to sleeping so idle stages don't burn a core
+    struct backoff {
+        unsigned spins;
+        backoff() : spins(0) {}
+        void operator()() {
+            if (++spins < 64) { std::this_thread::yield(); }
+            else { std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+        }
+    };
+
+    template <typename T>
+    void push(spsc_queue<T>& q, const T& v) {
+        for (backoff wait; !q.try_push(v); wait()) {}
+    }
+    template <typename T>
+    void pop(spsc_queue<T>& q, T& v) {
+        for (backoff wait; !q.try_pop(v); wait()) {}
+    }
+
+    // Length of the longest prefix of the bytes [p, p + n) which does not end
+    // in the middle of a code point. Malformed tails are left in place for
+    // validation to reject.
+    size_t complete_prefix(utf::utf8*, const char* p, size_t n) {
+        for (size_t back = 1; back <= 4 && back <= n; ++back) {
+            char c = p[n - back];
+            if ((c & 0xc0) != 0x80) {
+                return utf::internal::utf_traits<utf::utf8>::read_length(c) > back ? n - back : n;
+            }
+        }
+        return n;
+    }
+    size_t complete_prefix(utf::utf16*, const char* p, size_t n) {
+        n -= n % sizeof(char16_t);
+        if (n == 0) { return 0; }
+        char16_t last;
+        std::memcpy(&last, p + n - sizeof(char16_t), sizeof(char16_t));
+        return utf::internal::utf_traits<utf::utf16>::read_length(last) == 2 ? n - sizeof(char16_t) : n;
+    }
+    size_t complete_prefix(utf::utf32*, const char*, size_t n) {
+        return n - n % sizeof(char32_t);
+    }
+
+    struct block {
+        std::vector<char> in;
+        size_t in_len;
+        std::vector<char> out;
+        size_t out_len;
+        size_t codepoints;
+        bool valid;
+        bool last;
+    };
+
+    struct pipeline_result {
+        size_t bytes_in;
+        size_t codepoints;
+        bool valid;
+        bool write_ok;
+        int read_error; // errno of a failed read, or 0
+        int write_error; // errno of a failed write, or 0
+    };
+
+    template <typename CodeUnit, typename EDest>
+    void convert_block(block& b, bool convert, bool count) {
+        typedef typename utf::internal::native_encoding<CodeUnit>::type encoding;
+        typedef typename utf::internal::utf_traits<EDest>::codeunit_type out_type;
+
+        const CodeUnit* first = reinterpret_cast<const CodeUnit*>(b.in.data());
+        utf::stringview<const CodeUnit*> sv(first, first + b.in_len / sizeof(CodeUnit));
+        b.out_len = 0;
+        b.codepoints = 0;
+        // a tail that didn't form a complete code point by end of input is malformed
+        b.valid = complete_prefix(static_cast<encoding*>(0), b.in.data(), b.in_len) == b.in_len && sv.validate();
+        if (!b.valid) { return; }
+
+        // counting is another pass over the block, so only do it when asked
+        if (count) { b.codepoints = sv.codepoints(); }
+        if (convert) {
+            size_t cap = sv.codeunits() * max_units(static_cast<EDest*>(0)) * sizeof(out_type);
+            if (b.out.size() < cap) { b.out.resize(cap); }
+            out_type* out = reinterpret_cast<out_type*>(&b.out[0]);
+            b.out_len = (sv.template to<EDest>(out) - out) * sizeof(out_type);
+        }
+    }
+
+    template <typename CodeUnit, typename EDest>
+    pipeline_result run_pipeline(const options& opts, int in_fd, int out_fd) {
+        typedef typename utf::internal::native_encoding<CodeUnit>::type encoding;
+        const size_t block_size = 1024 * 1024;
+        const size_t carry_max = 4;
+        const bool convert = !opts.validate_only && !opts.count;
+
+        unsigned workers = opts.jobs;
+        if (workers == 0) {
+            unsigned hw = std::thread::hardware_concurrency();
+            workers = hw > 3 ? hw - 2 : 1;
+        }
+
+        // two blocks in flight per worker, plus one each for reader and writer
+        std::vector<block> blocks(2 * workers + 2);
+        spsc_queue<block*> free_blocks(blocks.size());
+        std::vector<spsc_queue<block*>*> todo;
+        std::vector<spsc_queue<block*>*> done;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            blocks[i].in.resize(block_size + carry_max);
+            free_blocks.try_push(&blocks[i]);
+        }
+        for (unsigned i = 0; i < workers; ++i) {
+            todo.push_back(new spsc_queue<block*>(blocks.size()));
+            done.push_back(new spsc_queue<block*>(blocks.size()));
+        }
+
+        std::atomic<bool> failed(false);
+        pipeline_result res = { 0, 0, true, true, 0, 0 };
+
+        std::thread reader([&]() {
+            char carry[carry_max];
+            size_t carry_len = 0;
+            for (unsigned w = 0; ; w = (w + 1) % workers) {
+                block* b;
+                pop(free_blocks, b);
+                std::memcpy(&b->in[0], carry, carry_len);
+                size_t len = carry_len;
+                bool eof = failed.load(std::memory_order_relaxed);
+                while (!eof && len < block_size + carry_len) {
+                    ssize_t r = ::read(in_fd, &b->in[len], block_size + carry_len - len);
+                    if (r < 0 && errno == EINTR) { continue; }
+                    if (r < 0) {
+                        // stop the pipeline; the error is reported once it has drained
+                        res.read_error = errno;
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                    if (r <= 0) {
+                        eof = true;
+                        break;
+                    }
+                    len += static_cast<size_t>(r);
+                    res.bytes_in += static_cast<size_t>(r);
+                }
+                // hand over whole code points only, and carry the rest into the next block
+                size_t cut = eof ? len : complete_prefix(static_cast<encoding*>(0), b->in.data(), len);
+                carry_len = len - cut;
+                std::memcpy(carry, &b->in[cut], carry_len);
+                b->in_len = cut;
+                b->last = eof;
+                push(*todo[w], b);
+                if (eof) { break; }
+            }
+        });
+
+        std::vector<std::thread> pool;
+        for (unsigned i = 0; i < workers; ++i) {
+            pool.push_back(std::thread([&, i]() {
+                for (;;) {
+                    block* b;
+                    pop(*todo[i], b);
+                    // a null block tells a worker to stop
+                    if (!b) { return; }
+                    convert_block<CodeUnit, EDest>(*b, convert, opts.count);
+                    bool last = b->last;
+                    push(*done[i], b);
+                    if (last) { break; }
+                }
+                // wake the other workers, which will never see the last block
+                for (unsigned j = 0; j < workers; ++j) {
+                    if (j != i) { push(*todo[j], static_cast<block*>(0)); }
+                }
+            }));
+        }
+
+        std::thread writer([&]() {
+            for (unsigned w = 0; ; w = (w + 1) % workers) {
+                block* b;
+                pop(*done[w], b);
+                if (b->valid && res.valid) {
+                    res.codepoints += b->codepoints;
+                    if (res.write_ok && b->out_len != 0) {
+                        res.write_ok = write_all(out_fd, b->out.data(), b->out_len);
+                        if (!res.write_ok) { res.write_error = errno; }
+                    }
+                }
+                else if (res.valid) {
+                    res.valid = false;
+                    failed.store(true, std::memory_order_relaxed);
+                }
+                bool last = b->last;
+                push(free_blocks, b);
+                if (last) { break; }
+            }
+        });
+
+        reader.join();
+        writer.join();
+        for (unsigned i = 0; i < workers; ++i) {
+            pool[i].join();
+            delete todo[i];
+            delete done[i];
+        }
+        return res;
+    }
+
+    template <typename CodeUnit>
+    int run(const options& opts, const mapped_input& in) {
+        const CodeUnit* first = static_cast<const CodeUnit*>(in.data);
+        utf::stringview<const CodeUnit*> sv(first, first + in.size / sizeof(CodeUnit));
+
+        if (!sv.validate()) {
+            std::fprintf(stderr, "utfconv: %s: malformed input\n", opts.input);
+            return 1;
+        }
+        if (opts.count) {
+            std::printf("%lu\n", static_cast<unsigned long>(sv.codepoints()));
+        }
+        if (opts.validate_only || opts.count) {
+            return 0;
+        }
+
+        bool ok = false;
+        switch (opts.to) {
+            case enc_utf8: ok = write_output<utf::utf8>(sv, opts.output); break;
+            case enc_utf16: ok = write_output<utf::utf16>(sv, opts.output); break;
+            case enc_utf32: ok = write_output<utf::utf32>(sv, opts.output); break;
+            default: break;
+        }
+        if (!ok) {
+            std::fprintf(stderr, "utfconv: %s: %s\n", opts.output ? opts.output : "-", std::strerror(errno));
+            return 2;
+        }
+        return 0;
+    }
+
+    template <typename CodeUnit>
+    int run_stream(const options& opts, int in_fd, size_t& bytes_in) {
+        int out_fd = 1;
+        if (!opts.validate_only && !opts.count) {
+            out_fd = open_output(opts.output);
+            if (out_fd < 0) {
+                std::fprintf(stderr, "utfconv: %s: %s\n", opts.output, std::strerror(errno));
+                return 2;
+            }
+        }
+
+        pipeline_result res = { 0, 0, false, false, 0, 0 };
+        switch (opts.to) {
+            case enc_utf8: res = run_pipeline<CodeUnit, utf::utf8>(opts, in_fd, out_fd); break;
+            case enc_utf16: res = run_pipeline<CodeUnit, utf::utf16>(opts, in_fd, out_fd); break;
+            case enc_utf32: res = run_pipeline<CodeUnit, utf::utf32>(opts, in_fd, out_fd); break;
+            default: break;
+        }
+        bytes_in = res.bytes_in;
+        if (out_fd != 1 && close(out_fd) != 0 && res.write_ok) {
+            res.write_ok = false;
+            res.write_error = errno;
+        }
+
+        // a failed read cuts the input short, so check it before validity
+        if (res.read_error != 0) {
+            std::fprintf(stderr, "utfconv: %s: %s\n", opts.input, std::strerror(res.read_error));
+            return 2;
+        }
+        if (!res.valid) {
+            std::fprintf(stderr, "utfconv: %s: malformed input\n", opts.input);
+            return 1;
+        }
+        if (!res.write_ok) {
+            std::fprintf(stderr, "utfconv: %s: %s\n", opts.output ? opts.output : "-", std::strerror(res.write_error));
+            return 2;
+        }
+        if (opts.count) {
+            std::printf("%lu\n", static_cast<unsigned long>(res.codepoints));
+        }
+        return 0;
+    }
+}
+
+int utfconv_main(int argc, char** argv) {
+    options opts;
+    if (!parse_args(argc, argv, opts)) {
+        usage();
+        return 2;
+    }
+
+    typedef std::chrono::steady_clock clock_type;
+    clock_type::time_point start = clock_type::now();
+
+    int in_fd = 0;
+    if (std::strcmp(opts.input, "-") != 0) {
+        in_fd = ::open(opts.input, O_RDONLY);
+    }
+    struct stat st;
+    if (in_fd < 0 || fstat(in_fd, &st) != 0) {
+        std::fprintf(stderr, "utfconv: %s: %s\n", opts.input, std::strerror(errno));
+        return 2;
+    }
+
+    int res = 2;
+    size_t bytes_in = 0;
+    mapped_input in;
+    if (S_ISREG(st.st_mode) && in.map(in_fd, static_cast<size_t>(st.st_size))) {
+        bytes_in = in.size;
+        if (in.size % unit_size(opts.from) != 0) {
+            std::fprintf(stderr, "utfconv: %s: size is not a multiple of the code unit size\n", opts.input);
+            res = 1;
+        }
+        else {
+            switch (opts.from) {
+                case enc_utf8: res = run<char>(opts, in); break;
+                case enc_utf16: res = run<char16_t>(opts, in); break;
+                case enc_utf32: res = run<char32_t>(opts, in); break;
+                default: break;
+            }
+        }
+    }
+    else {
+        switch (opts.from) {
+            case enc_utf8: res = run_stream<char>(opts, in_fd, bytes_in); break;
+            case enc_utf16: res = run_stream<char16_t>(opts, in_fd, bytes_in); break;
+            case enc_utf32: res = run_stream<char32_t>(opts, in_fd, bytes_in); break;
+            default: break;
+        }
+    }
+    if (in_fd != 0) { close(in_fd); }
+
+    if (opts.stats) {
+        double secs = std::chrono::duration<double>(clock_type::now() - start).count();
+        std::fprintf(stderr, "utfconv: %lu bytes in %.3f ms, %.3f GB/s\n"
+            , static_cast<unsigned long>(bytes_in), secs * 1e3
+            , secs > 0 ? bytes_in / secs / 1e9 : 0.0);
+    }
+    return res;
+}
+
+#ifndef UTFCONV_NO_MAIN
+int main(int argc, char** argv) {
+    return utfconv_main(argc, argv);
+}
+#endif